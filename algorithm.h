@@ -0,0 +1,634 @@
+#ifndef _ALGORITHM_H_
+#define _ALGORITHM_H_
+
+/**
+ * \file algorithm.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Algorithms on ranges of fractions
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "fraction.h"
+#include "expression.h"
+#include "parallel.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /**
+     * \brief Exact sum of a range of fractions, computed in parallel
+     * \param[in] first Random access iterator to the first fraction
+     * \param[in] last Random access iterator past the last fraction
+     * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+     * \return The sum of the fractions, 0 for an empty range
+     *
+     * Each thread groups its terms by denominator and adds the numerators of
+     * a group as plain integers, then the partial sums are combined in a
+     * balanced tree so that intermediate denominators stay small.
+     */
+    template <class Iterator>
+    typename std::iterator_traits<Iterator>::value_type sum(Iterator first, Iterator last, unsigned threads = 0);
+
+    /**
+     * \brief Exact product of a range of fractions, computed in parallel
+     * \param[in] first Random access iterator to the first fraction
+     * \param[in] last Random access iterator past the last fraction
+     * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+     * \return The product of the fractions, 1 for an empty range
+     *
+     * The factors are multiplied in a balanced tree, in each thread and then
+     * across threads.
+     */
+    template <class Iterator>
+    typename std::iterator_traits<Iterator>::value_type product(Iterator first, Iterator last, unsigned threads = 0);
+
+    /**
+     * \brief Best approximations with a bounded denominator of an array of floating numbers
+     * \param[in] first Random access iterator to the first floating number
+     * \param[in] last Random access iterator past the last floating number
+     * \param[out] out Array of last - first fractions
+     * \param[in] max_denominator The largest denominator allowed, 0 for the conversion of the constructor
+     * \param[in] tolerance Absolute error at which to stop, 0 to go as far as possible
+     * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+     *
+     * Each number is converted as by Fraction::approximate(), which with the
+     * default arguments is the conversion of the constructor from T2.
+     */
+    template <class Iterator, class T1, class T2, class Policy>
+    void approximate(Iterator first, Iterator last, Fraction<T1, T2, Policy> *out,
+                     typename std::common_type<T1>::type max_denominator = T1(0),
+                     typename std::common_type<T2>::type tolerance = T2(0), unsigned threads = 0);
+
+    /**
+     * \brief Sort of a range of fractions in ascending order
+     * \param[in] first Random access iterator to the first fraction
+     * \param[in] last Random access iterator past the last fraction
+     * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+     *
+     * For builtin integers, the fractions are sorted on a 64-bit key made of
+     * their double value by a radix sort, in parallel chunks merged
+     * afterwards. Exact comparisons are only done between fractions with the
+     * same key, and to repair the order of values not exactly representable
+     * in double. Other integer types use std::sort with exact comparisons.
+     */
+    template <class Iterator>
+    void sort(Iterator first, Iterator last, unsigned threads = 0);
+
+    /**
+     * \brief Removal of consecutive equal fractions
+     * \param[in] first Forward iterator to the first fraction
+     * \param[in] last Forward iterator past the last fraction
+     * \return Iterator past the last kept fraction
+     *
+     * On a sorted range, all the duplicates are removed.
+     */
+    template <class Iterator>
+    Iterator unique(Iterator first, Iterator last);
+
+    /**
+     * \brief First fraction not less than a value in a sorted range
+     * \param[in] first Random access iterator to the first fraction
+     * \param[in] last Random access iterator past the last fraction
+     * \param[in] value The fraction to search for
+     * \return Iterator to the first fraction greater than or equal to value, last if none
+     */
+    template <class Iterator, class T1, class T2, class Policy>
+    Iterator lower_bound(Iterator first, Iterator last, const Fraction<T1, T2, Policy> &value);
+
+    /**
+     * \brief Exact dot product of two ranges of fractions, computed in parallel
+     * \param[in] first1 Random access iterator to the first fraction of the first range
+     * \param[in] last1 Random access iterator past the last fraction of the first range
+     * \param[in] first2 Random access iterator to the first fraction of the second range
+     * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+     * \return The sum of the products of the fractions at the same position, 0 for empty ranges
+     *
+     * The products are kept unreduced in the wider builtin type of T1 (see
+     * Fraction), grouped by denominator, and the numerators of a group added
+     * as plain integers; each group is then reduced once and the groups are
+     * combined as in sum(). A product or a group overflowing the wide type is
+     * computed with the operators of Fraction instead.
+     */
+    template <class Iterator1, class Iterator2>
+    typename std::iterator_traits<Iterator1>::value_type dot(Iterator1 first1, Iterator1 last1, Iterator2 first2, unsigned threads = 0);
+
+    /**
+     * \brief Fused multiply-add of ranges of fractions, computed in parallel
+     * \param[in] first1 Random access iterator to the first factor a[0]
+     * \param[in] last1 Random access iterator past the last factor a[n - 1]
+     * \param[in] first2 Random access iterator to the first factor b[0]
+     * \param[in] first3 Random access iterator to the first term c[0]
+     * \param[out] out Random access iterator to the first result, may be first3
+     * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+     *
+     * Computes out[i] = a[i] * b[i] + c[i] with a single reduction per
+     * element, as by the expression expr(a[i]) * b[i] + c[i].
+     */
+    template <class Iterator1, class Iterator2, class Iterator3, class OutputIt>
+    void fma(Iterator1 first1, Iterator1 last1, Iterator2 first2, Iterator3 first3, OutputIt out, unsigned threads = 0);
+
+    /**
+     * \brief Scaled addition of a range of fractions to another, computed in parallel
+     * \param[in] alpha The scale
+     * \param[in] first Random access iterator to the first fraction x[0]
+     * \param[in] last Random access iterator past the last fraction x[n - 1]
+     * \param[in,out] y Random access iterator to the first fraction y[0]
+     * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+     *
+     * Computes y[i] = alpha * x[i] + y[i] with a single reduction per element.
+     */
+    template <class T1, class T2, class Policy, class Iterator, class OutputIt>
+    void axpy(const Fraction<T1, T2, Policy> &alpha, Iterator first, Iterator last, OutputIt y, unsigned threads = 0);
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    namespace detail
+    {
+        /**
+         * \brief Minimal number of fractions handled by a thread
+         */
+        const std::size_t fractionGrain = 4096;
+
+
+        /**
+         * \brief Serial sum of a range, grouping the terms by denominator
+         */
+        template <class Iterator>
+        typename std::iterator_traits<Iterator>::value_type sumRange(Iterator first, Iterator last)
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type F;
+            typedef typename F::integer_type T1;
+            typedef typename F::policy_type::arithmetic A;
+
+            std::vector<std::pair<T1, T1>> terms;
+            terms.reserve(std::size_t(last - first));
+            for (; first != last; ++first)
+                terms.emplace_back(first->getDenom(), first->getNum());
+
+            std::sort(terms.begin(), terms.end(),
+                      [](const std::pair<T1, T1> &a, const std::pair<T1, T1> &b) { return a.first < b.first; });
+
+            // One partial sum per denominator, or more if the numerators overflow
+            std::vector<F> partials;
+            for (std::size_t i = 0; i < terms.size();)
+            {
+                const T1 denom = terms[i].first;
+                T1 num = terms[i].second;
+
+                for (i++; i < terms.size() && terms[i].first == denom; i++)
+                {
+                    bool overflow = false;
+                    T1 next = A::add(num, terms[i].second, overflow);
+
+                    if (overflow)
+                    {
+                        partials.push_back(F(num, denom));
+                        next = terms[i].second;
+                    }
+                    num = next;
+                }
+
+                partials.push_back(F(num, denom));
+            }
+
+            return treeReduce(partials, F(), [](const F &a, const F &b) { return a + b; });
+        }
+
+
+        /**
+         * \brief Serial dot product of two ranges, grouping the unreduced products by denominator
+         */
+        template <class Iterator1, class Iterator2>
+        typename std::iterator_traits<Iterator1>::value_type dotRange(Iterator1 first1, Iterator1 last1, Iterator2 first2)
+        {
+            typedef typename std::iterator_traits<Iterator1>::value_type F;
+            typedef typename Accumulator<typename F::integer_type>::type I;
+            typedef CheckedArithmetic<> A;
+
+            // Unreduced product, with its position for the fallback
+            struct Term
+            {
+                I denom;
+                I num;
+                std::size_t index;
+            };
+
+            const std::size_t size = std::size_t(last1 - first1);
+            std::vector<Term> terms;
+            terms.reserve(size);
+            std::vector<F> partials;
+
+            for (std::size_t i = 0; i < size; i++)
+            {
+                const F &a = first1[i], &b = first2[i];
+                bool overflow = false;
+                I num = A::mul(I(a.getNum()), I(b.getNum()), overflow);
+                I denom = A::mul(I(a.getDenom()), I(b.getDenom()), overflow);
+
+                if (overflow)
+                    partials.push_back(a * b);
+                else
+                    terms.push_back({denom, num, i});
+            }
+
+            auto byDenominator = [](const Term &a, const Term &b) { return a.denom < b.denom; };
+            if (!std::is_sorted(terms.begin(), terms.end(), byDenominator))
+                std::sort(terms.begin(), terms.end(), byDenominator);
+
+            // Reduction of the group [begin, end), or its eager sum if it does not fit in T1
+            auto settle = [&](const I &num, const I &denom, std::size_t begin, std::size_t end) {
+                F value;
+                if (!narrow(num, denom, value))
+                {
+                    for (std::size_t j = begin; j < end; j++)
+                        value += first1[terms[j].index] * first2[terms[j].index];
+                }
+                partials.push_back(value);
+            };
+
+            for (std::size_t i = 0; i < terms.size();)
+            {
+                const I denom = terms[i].denom;
+                I num = terms[i].num;
+                std::size_t begin = i;
+
+                for (i++; i < terms.size() && terms[i].denom == denom; i++)
+                {
+                    bool overflow = false;
+                    I next = A::add(num, terms[i].num, overflow);
+
+                    if (overflow)
+                    {
+                        settle(num, denom, begin, i);
+                        begin = i;
+                        next = terms[i].num;
+                    }
+                    num = next;
+                }
+
+                settle(num, denom, begin, i);
+            }
+
+            return treeReduce(partials, F(), [](const F &a, const F &b) { return a + b; });
+        }
+
+
+        /**
+         * \brief Serial product of a range, multiplying both halves recursively
+         */
+        template <class Iterator>
+        typename std::iterator_traits<Iterator>::value_type productRange(Iterator first, Iterator last)
+        {
+            typedef typename std::iterator_traits<Iterator>::value_type F;
+            typedef typename F::integer_type T1;
+
+            std::size_t size = std::size_t(last - first);
+            if (size == 0)
+                return F(T1(1));
+            if (size == 1)
+                return *first;
+
+            Iterator middle = first + size / 2;
+            return productRange(first, middle) * productRange(middle, last);
+        }
+
+
+        /**
+         * \brief Sort key of a fraction and its position in the range
+         */
+        struct SortKey
+        {
+            std::uint64_t key;      /*!< Bits of the double value, ordered as unsigned integers */
+            std::size_t index;      /*!< Position of the fraction in the range */
+        };
+
+
+        /**
+         * \brief Bits of a double, in the same order as the numbers
+         * \param[in] value The double, not a NaN
+         * \return An integer which increases with value
+         */
+        inline std::uint64_t orderedBits(double value)
+        {
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            const std::uint64_t sign = std::uint64_t(1) << 63;
+            return (bits & sign) ? ~bits : bits | sign;
+        }
+
+
+        /**
+         * \brief Double of ordered bits, inverse of orderedBits()
+         * \param[in] key Bits given by orderedBits()
+         * \return The double
+         */
+        inline double orderedValue(std::uint64_t key)
+        {
+            const std::uint64_t sign = std::uint64_t(1) << 63;
+            const std::uint64_t bits = (key & sign) ? key & ~sign : ~key;
+
+            double value = 0;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+
+        /**
+         * \brief LSD radix sort of keys on 11-bit digits
+         * \param[in,out] data The keys to be sorted
+         * \param[in] buffer Room for as many keys
+         * \param[in] size Number of keys
+         *
+         * Digits shared by all the keys (exponents, mostly) are skipped.
+         */
+        inline void radixSort(SortKey *data, SortKey *buffer, std::size_t size)
+        {
+            const int bits = 11, buckets = 1 << bits;
+            std::vector<std::size_t> counts(buckets);
+            SortKey *from = data, *to = buffer;
+
+            for (int shift = 0; shift < 64; shift += bits)
+            {
+                std::fill(counts.begin(), counts.end(), std::size_t(0));
+                for (std::size_t i = 0; i < size; i++)
+                    counts[(from[i].key >> shift) & (buckets - 1)]++;
+
+                if (size == 0 || counts[(from[0].key >> shift) & (buckets - 1)] == size)
+                    continue;
+
+                std::size_t offset = 0;
+                for (std::size_t &count : counts)
+                {
+                    std::size_t tmp = count;
+                    count = offset;
+                    offset += tmp;
+                }
+
+                for (std::size_t i = 0; i < size; i++)
+                    to[counts[(from[i].key >> shift) & (buckets - 1)]++] = from[i];
+
+                std::swap(from, to);
+            }
+
+            if (from != data)
+                std::copy(from, from + size, data);
+        }
+
+
+        /**
+         * \brief Sort of keys in parallel: radix sorted chunks, then merged pairwise
+         * \param[in,out] keys The keys to be sorted
+         * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+         */
+        inline void sortKeys(std::vector<SortKey> &keys, unsigned threads)
+        {
+            const std::size_t size = keys.size();
+            unsigned chunks = threadCount(size, std::size_t(1) << 16, threads);
+            std::vector<SortKey> buffer(size);
+
+            auto byKey = [](const SortKey &a, const SortKey &b) { return a.key < b.key; };
+
+            parallelFor(size, chunks, [&](unsigned, std::size_t begin, std::size_t end) {
+                radixSort(keys.data() + begin, buffer.data() + begin, end - begin);
+            });
+
+            // Bounds of the sorted runs, as cut by parallelFor()
+            std::vector<std::size_t> bounds;
+            for (unsigned chunk = 0; chunk <= chunks; chunk++)
+                bounds.push_back(size * chunk / chunks);
+
+            while (bounds.size() > 2)
+            {
+                unsigned pairs = unsigned((bounds.size() - 1) / 2);
+
+                parallelFor(pairs, pairs, [&](unsigned pair, std::size_t, std::size_t) {
+                    std::size_t begin = bounds[2 * pair], middle = bounds[2 * pair + 1], end = bounds[2 * pair + 2];
+                    std::merge(keys.begin() + begin, keys.begin() + middle, keys.begin() + middle, keys.begin() + end,
+                               buffer.begin() + begin, byKey);
+                });
+
+                // An odd run out is copied as is
+                if ((bounds.size() - 1) % 2)
+                    std::copy(keys.begin() + bounds[bounds.size() - 2], keys.end(), buffer.begin() + bounds[bounds.size() - 2]);
+
+                keys.swap(buffer);
+
+                std::vector<std::size_t> merged;
+                for (std::size_t i = 0; i < bounds.size(); i += 2)
+                    merged.push_back(bounds[i]);
+                if (merged.back() != size)
+                    merged.push_back(size);
+                bounds.swap(merged);
+            }
+        }
+    }
+
+
+    template <class Iterator>
+    typename std::iterator_traits<Iterator>::value_type sum(Iterator first, Iterator last, unsigned threads)
+    {
+        static_assert(std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value,
+                      "frac::sum requires random access iterators");
+        typedef typename std::iterator_traits<Iterator>::value_type F;
+
+        std::size_t size = std::size_t(last - first);
+        unsigned chunks = detail::threadCount(size, detail::fractionGrain, threads);
+
+        std::vector<F> partials(chunks);
+        detail::parallelFor(size, chunks, [&](unsigned chunk, std::size_t begin, std::size_t end) {
+            partials[chunk] = detail::sumRange(first + begin, first + end);
+        });
+
+        return detail::treeReduce(partials, F(), [](const F &a, const F &b) { return a + b; });
+    }
+
+
+    template <class Iterator>
+    typename std::iterator_traits<Iterator>::value_type product(Iterator first, Iterator last, unsigned threads)
+    {
+        static_assert(std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value,
+                      "frac::product requires random access iterators");
+        typedef typename std::iterator_traits<Iterator>::value_type F;
+        typedef typename F::integer_type T1;
+
+        std::size_t size = std::size_t(last - first);
+        unsigned chunks = detail::threadCount(size, detail::fractionGrain, threads);
+
+        std::vector<F> partials(chunks);
+        detail::parallelFor(size, chunks, [&](unsigned chunk, std::size_t begin, std::size_t end) {
+            partials[chunk] = detail::productRange(first + begin, first + end);
+        });
+
+        return detail::treeReduce(partials, F(T1(1)), [](const F &a, const F &b) { return a * b; });
+    }
+
+
+    template <class Iterator, class T1, class T2, class Policy>
+    void approximate(Iterator first, Iterator last, Fraction<T1, T2, Policy> *out,
+                     typename std::common_type<T1>::type max_denominator,
+                     typename std::common_type<T2>::type tolerance, unsigned threads)
+    {
+        std::size_t size = std::size_t(last - first);
+        unsigned chunks = detail::threadCount(size, detail::fractionGrain, threads);
+
+        detail::parallelFor(size, chunks, [&](unsigned, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+                out[i] = Fraction<T1, T2, Policy>::approximate(T2(first[i]), max_denominator, tolerance);
+        });
+    }
+
+
+    template <class Iterator>
+    void sort(Iterator first, Iterator last, unsigned threads)
+    {
+        static_assert(std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>::value,
+                      "frac::sort requires random access iterators");
+        typedef typename std::iterator_traits<Iterator>::value_type F;
+        typedef typename F::integer_type T1;
+
+        auto less = [](const F &a, const F &b) { return a.compare(b) < 0; };
+
+        if constexpr (!detail::IsBuiltinInteger<T1>::value)
+            std::sort(first, last, less);
+        else {
+            const std::size_t size = std::size_t(last - first);
+
+            // Keys, and whether every term is exactly representable in double
+            std::vector<detail::SortKey> keys(size);
+            bool monotonic = true;
+            for (std::size_t i = 0; i < size; i++)
+            {
+                T1 num = first[i].getNum(), denom = first[i].getDenom();
+                keys[i].key = detail::orderedBits(double(num) / double(denom));
+                keys[i].index = i;
+
+                if constexpr (sizeof(T1) > 4)
+                {
+                    const T1 exact = T1(1) << 53;
+                    if (num > exact || num < -exact || denom > exact)
+                        monotonic = false;
+                }
+            }
+
+            detail::sortKeys(keys, threads);
+
+            // Three roundings keep a key within 4 * 2^-53 of its fraction, relatively, and exact terms
+            // give a monotonic key: only runs of overlapping windows may be misplaced, sorted exactly
+            const double error = monotonic ? 0.0 : 4.0 * std::numeric_limits<double>::epsilon() / 2;
+            auto byValue = [&](const detail::SortKey &a, const detail::SortKey &b) {
+                return first[a.index].compare(first[b.index]) < 0;
+            };
+            for (std::size_t i = 0; i < size;)
+            {
+                double value = detail::orderedValue(keys[i].key);
+                double high = value + error * std::fabs(value);
+
+                std::size_t j = i + 1;
+                for (; j < size; j++)
+                {
+                    value = detail::orderedValue(keys[j].key);
+                    if (keys[j].key != keys[j - 1].key && value - error * std::fabs(value) > high)
+                        break;
+                    high = std::max(high, value + error * std::fabs(value));
+                }
+
+                if (j - i > 1)
+                    std::sort(keys.begin() + i, keys.begin() + j, byValue);
+                i = j;
+            }
+
+            std::vector<F> sorted;
+            sorted.reserve(size);
+            for (const detail::SortKey &key : keys)
+                sorted.push_back(std::move(first[key.index]));
+            std::move(sorted.begin(), sorted.end(), first);
+        }
+    }
+
+
+    template <class Iterator>
+    Iterator unique(Iterator first, Iterator last)
+    {
+        // Equality of canonical forms is the cheapest comparison
+        return std::unique(first, last);
+    }
+
+
+    template <class Iterator, class T1, class T2, class Policy>
+    Iterator lower_bound(Iterator first, Iterator last, const Fraction<T1, T2, Policy> &value)
+    {
+        return std::lower_bound(first, last, value,
+                                [](const Fraction<T1, T2, Policy> &a, const Fraction<T1, T2, Policy> &b) { return a.compare(b) < 0; });
+    }
+
+    template <class Iterator1, class Iterator2>
+    typename std::iterator_traits<Iterator1>::value_type dot(Iterator1 first1, Iterator1 last1, Iterator2 first2, unsigned threads)
+    {
+        static_assert(std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<Iterator1>::iterator_category>::value,
+                      "frac::dot requires random access iterators");
+        typedef typename std::iterator_traits<Iterator1>::value_type F;
+
+        std::size_t size = std::size_t(last1 - first1);
+        unsigned chunks = detail::threadCount(size, detail::fractionGrain, threads);
+
+        std::vector<F> partials(chunks);
+        detail::parallelFor(size, chunks, [&](unsigned chunk, std::size_t begin, std::size_t end) {
+            partials[chunk] = detail::dotRange(first1 + begin, first1 + end, first2 + begin);
+        });
+
+        return detail::treeReduce(partials, F(), [](const F &a, const F &b) { return a + b; });
+    }
+
+
+    template <class Iterator1, class Iterator2, class Iterator3, class OutputIt>
+    void fma(Iterator1 first1, Iterator1 last1, Iterator2 first2, Iterator3 first3, OutputIt out, unsigned threads)
+    {
+        std::size_t size = std::size_t(last1 - first1);
+        unsigned chunks = detail::threadCount(size, detail::fractionGrain, threads);
+
+        detail::parallelFor(size, chunks, [&](unsigned, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+                out[i] = (expr(first1[i]) * first2[i] + first3[i]).eval();
+        });
+    }
+
+
+    template <class T1, class T2, class Policy, class Iterator, class OutputIt>
+    void axpy(const Fraction<T1, T2, Policy> &alpha, Iterator first, Iterator last, OutputIt y, unsigned threads)
+    {
+        std::size_t size = std::size_t(last - first);
+        unsigned chunks = detail::threadCount(size, detail::fractionGrain, threads);
+
+        detail::parallelFor(size, chunks, [&](unsigned, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+                y[i] = (expr(alpha) * first[i] + y[i]).eval();
+        });
+    }
+}
+
+
+#endif  /*_ALGORITHM_H_*/
@@ -0,0 +1,386 @@
+#ifndef _ATOMIC_FRACTION_H_
+#define _ATOMIC_FRACTION_H_
+
+/**
+ * \file atomic_fraction.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Lock-free fraction accumulators shared between threads
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "fraction.h"
+#include "packed.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /**
+     * \class AtomicFraction
+     * \brief Fraction updated atomically by a compare-and-swap loop on its packed word
+     *
+     * While the value fits in Packed, every operation is a lock-free
+     * read-modify-write of a single atomic word. A result that does not fit
+     * promotes the accumulator: the word then holds the marker of
+     * PackedArray and the value is kept as a wide fraction behind a mutex,
+     * until a result fits again. An operation overflowing value_type throws
+     * as value_type does, the value being left unchanged.
+     */
+    template <class Packed = Packed64<>>
+    class AtomicFraction
+    {
+    public:
+        typedef typename Packed::wide_type value_type;  /*!< Type of the values */
+        typedef typename Packed::word_type word_type;   /*!< Type of the atomic word */
+
+    private:
+        std::atomic<word_type> word;    /*!< Packed value, or the marker once promoted */
+        mutable std::mutex lock;        /*!< Guard of the promoted value */
+        value_type promoted;            /*!< Value while it does not fit in Packed */
+
+        /**
+         * \brief Word marking a promoted value
+         */
+        static constexpr word_type marker();
+
+        /**
+         * \brief Read-modify-write of the value
+         * \param[in] update Function giving the new value from the current one
+         * \return The previous value
+         */
+        template <class Function>
+        value_type modify(Function &&update);
+
+    public:
+        /**
+         * \brief Constructor
+         * \param[in] value Initial value
+         */
+        explicit AtomicFraction(const value_type &value = value_type());
+
+        AtomicFraction(const AtomicFraction &) = delete;
+        AtomicFraction &operator=(const AtomicFraction &) = delete;
+
+        /**
+         * \brief Atomic read
+         * \return The current value
+         */
+        value_type load() const;
+
+        /**
+         * \brief Atomic write
+         * \param[in] value The new value
+         */
+        void store(const value_type &value);
+
+        /**
+         * \brief Atomic addition
+         * \param[in] value The fraction to be added
+         * \return The previous value
+         */
+        value_type fetchAdd(const value_type &value);
+
+        /**
+         * \brief Atomic subtraction
+         * \param[in] value The fraction to be subtracted
+         * \return The previous value
+         */
+        value_type fetchSub(const value_type &value);
+
+        /**
+         * \brief Overloading of += operator
+         * \param[in] value The fraction to be added
+         * \return The new value, as std::atomic
+         */
+        value_type operator+=(const value_type &value);
+
+        /**
+         * \brief Overloading of -= operator
+         * \param[in] value The fraction to be subtracted
+         * \return The new value, as std::atomic
+         */
+        value_type operator-=(const value_type &value);
+
+        /**
+         * \brief Tells whether the operations are currently lock-free
+         * \return False while the value is promoted
+         */
+        bool isLockFree() const;
+    };
+
+
+    /**
+     * \class ShardedFraction
+     * \brief Accumulator split in per-thread shards, merged on read
+     *
+     * Each thread adds to its own AtomicFraction, on its own cache line, so
+     * that concurrent additions do not contend; load() sums the shards.
+     * Threads are assigned to shards in turn, sharing them if there are
+     * more threads than shards.
+     */
+    template <class Packed = Packed64<>>
+    class ShardedFraction
+    {
+    public:
+        typedef typename Packed::wide_type value_type;  /*!< Type of the values */
+
+    private:
+        /**
+         * \brief Shard alone on its cache lines
+         */
+        struct alignas(64) Shard
+        {
+            AtomicFraction<Packed> value;   /*!< Partial sum */
+        };
+
+        std::vector<Shard> shards;  /*!< The partial sums */
+
+        /**
+         * \brief Shard of the calling thread
+         */
+        Shard &local();
+
+    public:
+        /**
+         * \brief Constructor, accumulator equal to 0
+         * \param[in] count Number of shards, 0 for the hardware concurrency
+         */
+        explicit ShardedFraction(unsigned count = 0);
+
+        /**
+         * \brief Addition to the shard of the calling thread
+         * \param[in] value The fraction to be added
+         */
+        void add(const value_type &value);
+
+        /**
+         * \brief Overloading of += operator, see add()
+         * \param[in] value The fraction to be added
+         * \return A reference to the accumulator
+         */
+        ShardedFraction &operator+=(const value_type &value);
+
+        /**
+         * \brief Sum of the shards
+         * \return The accumulated value, exact once the writers are done
+         */
+        value_type load() const;
+
+        /**
+         * \brief Reset of every shard to 0
+         */
+        void reset();
+    };
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    namespace detail
+    {
+        /**
+         * \brief Index of the calling thread, given in turn at its first call
+         */
+        inline unsigned threadIndex()
+        {
+            static std::atomic<unsigned> next(0);
+            thread_local unsigned index = next.fetch_add(1, std::memory_order_relaxed);
+            return index;
+        }
+    }
+
+
+    template <class Packed>
+    constexpr typename AtomicFraction<Packed>::word_type AtomicFraction<Packed>::marker()
+    {
+        // Numerator -2^(NumeratorBits - 1), never packed
+        return word_type(word_type(1) << (8 * sizeof(word_type) - 1));
+    }
+
+
+    template <class Packed>
+    AtomicFraction<Packed>::AtomicFraction(const value_type &value)
+        : word(word_type(0))
+    {
+        this->store(value);
+    }
+
+
+    template <class Packed>
+    typename AtomicFraction<Packed>::value_type AtomicFraction<Packed>::load() const
+    {
+        const word_type current = word.load(std::memory_order_acquire);
+        if (current != marker())
+            return value_type(Packed::fromWord(current));
+
+        std::lock_guard<std::mutex> guard(lock);
+        const word_type again = word.load(std::memory_order_acquire);
+        return again == marker() ? promoted : value_type(Packed::fromWord(again));
+    }
+
+
+    template <class Packed>
+    void AtomicFraction<Packed>::store(const value_type &value)
+    {
+        std::lock_guard<std::mutex> guard(lock);
+
+        Packed packed;
+        if (Packed::pack(value, packed))
+            word.store(packed.word(), std::memory_order_release);
+        else {
+            promoted = value;
+            word.store(marker(), std::memory_order_release);
+        }
+    }
+
+
+    template <class Packed>
+    template <class Function>
+    typename AtomicFraction<Packed>::value_type AtomicFraction<Packed>::modify(Function &&update)
+    {
+        word_type current = word.load(std::memory_order_acquire);
+        for (;;)
+        {
+            if (current != marker())
+            {
+                const value_type previous(Packed::fromWord(current));
+                const value_type result = update(previous);
+
+                Packed packed;
+                if (Packed::pack(result, packed))
+                {
+                    // On failure current is reloaded and the update computed again
+                    if (word.compare_exchange_weak(current, packed.word(), std::memory_order_acq_rel, std::memory_order_acquire))
+                        return previous;
+                    continue;
+                }
+
+                // Promotion, the mutex being taken before the word changes
+                std::lock_guard<std::mutex> guard(lock);
+                if (word.compare_exchange_strong(current, marker(), std::memory_order_acq_rel, std::memory_order_acquire))
+                {
+                    promoted = result;
+                    return previous;
+                }
+                continue;
+            }
+
+            std::lock_guard<std::mutex> guard(lock);
+            current = word.load(std::memory_order_acquire);
+            if (current != marker())
+                continue;
+
+            // Back to the lock-free word as soon as the value fits again
+            const value_type previous = promoted;
+            const value_type result = update(previous);
+            Packed packed;
+            if (Packed::pack(result, packed))
+                word.store(packed.word(), std::memory_order_release);
+            else
+                promoted = result;
+
+            return previous;
+        }
+    }
+
+
+    template <class Packed>
+    typename AtomicFraction<Packed>::value_type AtomicFraction<Packed>::fetchAdd(const value_type &value)
+    {
+        return this->modify([&value](const value_type &current) { return current + value; });
+    }
+
+
+    template <class Packed>
+    typename AtomicFraction<Packed>::value_type AtomicFraction<Packed>::fetchSub(const value_type &value)
+    {
+        return this->modify([&value](const value_type &current) { return current - value; });
+    }
+
+
+    template <class Packed>
+    typename AtomicFraction<Packed>::value_type AtomicFraction<Packed>::operator+=(const value_type &value)
+    {
+        return this->fetchAdd(value) + value;
+    }
+
+
+    template <class Packed>
+    typename AtomicFraction<Packed>::value_type AtomicFraction<Packed>::operator-=(const value_type &value)
+    {
+        return this->fetchSub(value) - value;
+    }
+
+
+    template <class Packed>
+    bool AtomicFraction<Packed>::isLockFree() const
+    {
+        return word.is_lock_free() && word.load(std::memory_order_acquire) != marker();
+    }
+
+
+    template <class Packed>
+    ShardedFraction<Packed>::ShardedFraction(unsigned count)
+        : shards(count != 0 ? count : std::max(1u, std::thread::hardware_concurrency()))
+    {
+    }
+
+
+    template <class Packed>
+    typename ShardedFraction<Packed>::Shard &ShardedFraction<Packed>::local()
+    {
+        return shards[detail::threadIndex() % shards.size()];
+    }
+
+
+    template <class Packed>
+    void ShardedFraction<Packed>::add(const value_type &value)
+    {
+        this->local().value.fetchAdd(value);
+    }
+
+
+    template <class Packed>
+    ShardedFraction<Packed> &ShardedFraction<Packed>::operator+=(const value_type &value)
+    {
+        this->add(value);
+        return *this;
+    }
+
+
+    template <class Packed>
+    typename ShardedFraction<Packed>::value_type ShardedFraction<Packed>::load() const
+    {
+        value_type sum;
+        for (const Shard &shard : shards)
+            sum += shard.value.load();
+
+        return sum;
+    }
+
+
+    template <class Packed>
+    void ShardedFraction<Packed>::reset()
+    {
+        for (Shard &shard : shards)
+            shard.value.store(value_type());
+    }
+}
+
+
+#endif  /*_ATOMIC_FRACTION_H_*/
@@ -0,0 +1,1279 @@
+#ifndef _BIGINT_H_
+#define _BIGINT_H_
+
+/**
+ * \file bigint.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Arbitrary precision integer usable as the integer type of Fraction
+ */
+
+#include <iostream>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include "fraction.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    namespace detail
+    {
+        /**
+         * \class LimbPool
+         * \brief Thread local cache of limb arrays, by power of two capacity
+         *
+         * Released arrays are kept for reuse so that temporaries do not go
+         * through the heap in steady state. Each array is allocated on its
+         * own, hence an array may be released by another thread than the
+         * one which allocated it.
+         */
+        class LimbPool
+        {
+        public:
+            /**
+             * \brief Array of at least capacity limbs
+             * \param[in,out] capacity Requested, then actual number of limbs
+             * \return The array
+             */
+            static uint32_t *allocate(uint32_t &capacity);
+
+            /**
+             * \brief Gives an array back to the cache of the calling thread
+             * \param[in] limbs The array
+             * \param[in] capacity Its actual number of limbs
+             */
+            static void release(uint32_t *limbs, uint32_t capacity);
+
+        private:
+            static const unsigned int classes = 16;     /*!< Capacities from 4 to 4 << 15 limbs */
+            static const unsigned int depth = 64;       /*!< Cached arrays per capacity */
+
+            /**
+             * \brief Free lists of one thread, the next pointer is stored in the array itself
+             */
+            struct Cache
+            {
+                void *head[classes] = {};
+                unsigned int count[classes] = {};
+
+                ~Cache();
+            };
+
+            static Cache &cache();
+        };
+
+
+        /**
+         * \class Limbs
+         * \brief Owning array of 32-bit limbs drawn from the LimbPool, little endian
+         */
+        struct Limbs
+        {
+            uint32_t *data = nullptr;   /*!< The limbs, nullptr if none */
+            uint32_t size = 0;          /*!< Number of limbs in use */
+            uint32_t capacity = 0;      /*!< Number of limbs allocated */
+
+            Limbs() = default;
+
+            /**
+             * \brief Zeroed array of n limbs
+             * \param[in] n Number of limbs in use
+             */
+            explicit Limbs(uint32_t n);
+
+            Limbs(const Limbs &) = delete;
+            Limbs &operator=(const Limbs &) = delete;
+            Limbs(Limbs &&other) noexcept;
+            Limbs &operator=(Limbs &&other) noexcept;
+            ~Limbs();
+
+            /**
+             * \brief Removal of the leading zero limbs
+             */
+            void trim();
+        };
+    }
+
+
+
+    /**
+     * \class BigInt
+     * \brief Signed arbitrary precision integer with small value optimization
+     *
+     * Values fitting in 64 bits are stored inline and computed with native
+     * arithmetic; larger values spill to an array of limbs. A value is
+     * always stored inline when it fits, so that the two representations
+     * never overlap. Division and remainder truncate toward zero and right
+     * shifts round toward minus infinity, like builtin integers.
+     */
+    class BigInt
+    {
+        /**
+         * \brief Overloading of << operator, decimal output
+         * \param[in] o Reference to a std::ostream object
+         * \param[in] value The integer to be displayed
+         * \return A reference to the modified stream
+         */
+        friend std::ostream &operator<<(std::ostream &o, const BigInt &value);
+
+        /**
+         * \brief Overloading of >> operator, decimal input
+         * \param[in] i Reference to a std::istream object
+         * \param[in] value Reference to the integer in which to insert data
+         * \return A reference to the modified stream
+         */
+        friend std::istream &operator>>(std::istream &i, BigInt &value);
+
+    private:
+        int64_t small;          /*!< The value when inline, else the sign (1 or -1) */
+        detail::Limbs limbs;    /*!< Magnitude when the value does not fit inline */
+
+        /**
+         * \brief Read only magnitude of a BigInt, inline values included
+         */
+        struct View
+        {
+            const uint32_t *data;   /*!< Limbs of the magnitude */
+            uint32_t size;          /*!< Number of limbs, 0 for zero */
+            bool negative;          /*!< Sign of the value */
+            uint32_t local[2];      /*!< Storage for inline values */
+
+            explicit View(const BigInt &value);
+            View(const View &) = delete;
+        };
+
+        /**
+         * \brief Assignment of a magnitude and a sign, stored inline if possible
+         * \param[in] magnitude The magnitude, taken over
+         * \param[in] negative The sign
+         */
+        void assign(detail::Limbs &&magnitude, bool negative);
+
+        /**
+         * \brief Sum or difference of two integers, general case
+         */
+        static BigInt addLarge(const BigInt &a, const BigInt &b, bool subtract);
+
+        /**
+         * \brief Product of two integers, general case
+         */
+        static BigInt mulLarge(const BigInt &a, const BigInt &b);
+
+        /**
+         * \brief Truncated division of two integers, general case
+         */
+        static void divLarge(const BigInt &a, const BigInt &b, BigInt *quotient, BigInt *remainder);
+
+    public:
+        /**
+         * \brief Default constructor, zero
+         */
+        BigInt();
+
+        /**
+         * \brief Constructor from any builtin integer
+         * \param[in] value The integer
+         */
+        template <class I, typename std::enable_if<std::is_integral<I>::value, int>::type = 0>
+        BigInt(I value);
+
+        /**
+         * \brief Constructor from a floating number, truncated toward zero
+         * \param[in] value The finite floating number
+         */
+        template <class F, typename std::enable_if<std::is_floating_point<F>::value, int>::type = 0>
+        explicit BigInt(F value);
+
+        /**
+         * \brief Constructor from a decimal string with optional sign
+         * \param[in] digits The null terminated string
+         */
+        explicit BigInt(const char *digits);
+
+        /**
+         * \brief Copy constructor
+         * \param[in] other The integer to be copied
+         */
+        BigInt(const BigInt &other);
+
+        /**
+         * \brief Move constructor
+         * \param[in] other The integer to be moved, left to zero
+         */
+        BigInt(BigInt &&other) noexcept;
+
+        /**
+         * \brief Assignment operator
+         * \param[in] other The integer to be assigned
+         * \return A reference to the modified integer
+         */
+        BigInt &operator=(const BigInt &other);
+
+        /**
+         * \brief Move assignment operator
+         * \param[in] other The integer to be moved, left to zero
+         * \return A reference to the modified integer
+         */
+        BigInt &operator=(BigInt &&other) noexcept;
+
+        /**
+         * \brief Tells whether the value is stored inline
+         * \return True if the value fits in 64 bits
+         */
+        bool isSmall() const;
+
+        /**
+         * \brief Inline value
+         * \return The value, only meaningful if isSmall()
+         */
+        int64_t toInt64() const;
+
+        /**
+         * \brief Sign of the integer
+         * \return -1, 0 or 1
+         */
+        int sign() const;
+
+        /**
+         * \brief Number of bits of the magnitude
+         * \return The position of the highest set bit plus one, 0 for zero
+         */
+        unsigned int bitLength() const;
+
+        /**
+         * \brief Conversion to a floating type, correctly rounded up to double
+         * \return The floating value, infinite if out of range
+         */
+        template <class F, typename std::enable_if<std::is_floating_point<F>::value, int>::type = 0>
+        explicit operator F() const;
+
+        /**
+         * \brief Decimal representation
+         * \return The string of digits, with a leading '-' if negative
+         */
+        std::string toString() const;
+
+        /**
+         * \brief Hash of the value
+         * \return The value itself when inline, else a mix of the sign and the limbs
+         */
+        std::size_t hash() const;
+
+        /**
+         * \brief Overloading of unary - operator
+         * \return The opposite of the integer
+         */
+        BigInt operator-() const;
+
+        BigInt &operator+=(const BigInt &other);    /*!< \brief Overloading of += operator */
+        BigInt &operator-=(const BigInt &other);    /*!< \brief Overloading of -= operator */
+        BigInt &operator*=(const BigInt &other);    /*!< \brief Overloading of *= operator */
+        BigInt &operator/=(const BigInt &other);    /*!< \brief Overloading of /= operator, truncated */
+        BigInt &operator%=(const BigInt &other);    /*!< \brief Overloading of %= operator, sign of the dividend */
+        BigInt &operator<<=(unsigned int shift);    /*!< \brief Overloading of <<= operator */
+        BigInt &operator>>=(unsigned int shift);    /*!< \brief Overloading of >>= operator, toward minus infinity */
+
+        friend BigInt operator+(const BigInt &a, const BigInt &b);
+        friend BigInt operator-(const BigInt &a, const BigInt &b);
+        friend BigInt operator*(const BigInt &a, const BigInt &b);
+        friend BigInt operator/(const BigInt &a, const BigInt &b);
+        friend BigInt operator%(const BigInt &a, const BigInt &b);
+        friend BigInt operator<<(const BigInt &a, unsigned int shift);
+        friend BigInt operator>>(const BigInt &a, unsigned int shift);
+
+        /**
+         * \brief Three way comparison
+         * \param[in] a First integer
+         * \param[in] b Second integer
+         * \return A negative, zero or positive value if a < b, a == b or a > b
+         */
+        static int compare(const BigInt &a, const BigInt &b);
+
+        /**
+         * \brief Truncated division with remainder
+         * \param[in] a The dividend
+         * \param[in] b The non zero divisor
+         * \param[out] quotient a / b
+         * \param[out] remainder a % b
+         */
+        static void divmod(const BigInt &a, const BigInt &b, BigInt &quotient, BigInt &remainder);
+    };
+
+    inline bool operator==(const BigInt &a, const BigInt &b) { return BigInt::compare(a, b) == 0; }
+    inline bool operator!=(const BigInt &a, const BigInt &b) { return BigInt::compare(a, b) != 0; }
+    inline bool operator<(const BigInt &a, const BigInt &b) { return BigInt::compare(a, b) < 0; }
+    inline bool operator<=(const BigInt &a, const BigInt &b) { return BigInt::compare(a, b) <= 0; }
+    inline bool operator>(const BigInt &a, const BigInt &b) { return BigInt::compare(a, b) > 0; }
+    inline bool operator>=(const BigInt &a, const BigInt &b) { return BigInt::compare(a, b) >= 0; }
+
+
+    /**
+     * \fn BigInt abs(const BigInt &value);
+     * \brief Absolute value
+     * \param value The integer
+     * \return |value|
+     */
+    inline BigInt abs(const BigInt &value)
+    {
+        return value.sign() < 0 ? -value : value;
+    }
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    namespace detail
+    {
+        inline LimbPool::Cache::~Cache()
+        {
+            for (unsigned int c = 0; c < classes; c++)
+            {
+                while (head[c] != nullptr)
+                {
+                    void *next = *static_cast<void **>(head[c]);
+                    ::operator delete(head[c]);
+                    head[c] = next;
+                }
+            }
+        }
+
+
+        inline LimbPool::Cache &LimbPool::cache()
+        {
+            thread_local Cache instance;
+            return instance;
+        }
+
+
+        inline uint32_t *LimbPool::allocate(uint32_t &capacity)
+        {
+            unsigned int c = 0;
+            while (c < classes && (4u << c) < capacity)
+                c++;
+
+            if (c == classes)
+                return static_cast<uint32_t *>(::operator new(capacity * sizeof(uint32_t)));
+
+            capacity = 4u << c;
+
+            Cache &pool = cache();
+            if (pool.head[c] != nullptr)
+            {
+                void *block = pool.head[c];
+                pool.head[c] = *static_cast<void **>(block);
+                pool.count[c]--;
+                return static_cast<uint32_t *>(block);
+            }
+
+            return static_cast<uint32_t *>(::operator new(capacity * sizeof(uint32_t)));
+        }
+
+
+        inline void LimbPool::release(uint32_t *limbs, uint32_t capacity)
+        {
+            unsigned int c = 0;
+            while (c < classes && (4u << c) < capacity)
+                c++;
+
+            Cache &pool = cache();
+            if (c == classes || pool.count[c] == depth)
+            {
+                ::operator delete(limbs);
+                return;
+            }
+
+            *reinterpret_cast<void **>(limbs) = pool.head[c];
+            pool.head[c] = limbs;
+            pool.count[c]++;
+        }
+
+
+        inline Limbs::Limbs(uint32_t n) : size(n), capacity(n)
+        {
+            data = LimbPool::allocate(capacity);
+            std::memset(data, 0, n * sizeof(uint32_t));
+        }
+
+
+        inline Limbs::Limbs(Limbs &&other) noexcept
+            : data(other.data), size(other.size), capacity(other.capacity)
+        {
+            other.data = nullptr;
+            other.size = other.capacity = 0;
+        }
+
+
+        inline Limbs &Limbs::operator=(Limbs &&other) noexcept
+        {
+            if (this != &other)
+            {
+                if (data != nullptr)
+                    LimbPool::release(data, capacity);
+
+                data = other.data;
+                size = other.size;
+                capacity = other.capacity;
+                other.data = nullptr;
+                other.size = other.capacity = 0;
+            }
+
+            return *this;
+        }
+
+
+        inline Limbs::~Limbs()
+        {
+            if (data != nullptr)
+                LimbPool::release(data, capacity);
+        }
+
+
+        inline void Limbs::trim()
+        {
+            while (size > 0 && data[size - 1] == 0)
+                size--;
+        }
+
+
+        /**
+         * \brief Comparison of two magnitudes without leading zeros
+         */
+        inline int compareMagnitude(const uint32_t *a, uint32_t na, const uint32_t *b, uint32_t nb)
+        {
+            if (na != nb)
+                return na < nb ? -1 : 1;
+
+            for (uint32_t i = na; i-- > 0;)
+            {
+                if (a[i] != b[i])
+                    return a[i] < b[i] ? -1 : 1;
+            }
+
+            return 0;
+        }
+
+
+        /**
+         * \brief r = a + b with na >= nb, r has na + 1 limbs
+         */
+        inline void addMagnitude(uint32_t *r, const uint32_t *a, uint32_t na, const uint32_t *b, uint32_t nb)
+        {
+            uint64_t carry = 0;
+            for (uint32_t i = 0; i < na; i++)
+            {
+                carry += uint64_t(a[i]) + (i < nb ? b[i] : 0);
+                r[i] = uint32_t(carry);
+                carry >>= 32;
+            }
+            r[na] = uint32_t(carry);
+        }
+
+
+        /**
+         * \brief r = a - b with a >= b, r has na limbs
+         */
+        inline void subMagnitude(uint32_t *r, const uint32_t *a, uint32_t na, const uint32_t *b, uint32_t nb)
+        {
+            int64_t borrow = 0;
+            for (uint32_t i = 0; i < na; i++)
+            {
+                int64_t t = int64_t(a[i]) - (i < nb ? b[i] : 0) - borrow;
+                borrow = t < 0;
+                r[i] = uint32_t(t);
+            }
+        }
+
+
+        /**
+         * \brief r = a * b, r has na + nb zeroed limbs
+         */
+        inline void mulMagnitude(uint32_t *r, const uint32_t *a, uint32_t na, const uint32_t *b, uint32_t nb)
+        {
+            for (uint32_t i = 0; i < na; i++)
+            {
+                uint64_t carry = 0, ai = a[i];
+                for (uint32_t j = 0; j < nb; j++)
+                {
+                    carry += ai * b[j] + r[i + j];
+                    r[i + j] = uint32_t(carry);
+                    carry >>= 32;
+                }
+                r[i + nb] = uint32_t(carry);
+            }
+        }
+
+
+        /**
+         * \brief Knuth's algorithm D, q = u / v and r = u % v with nu >= nv >= 1
+         *
+         * q has nu - nv + 1 zeroed limbs and r has nv zeroed limbs.
+         */
+        inline void divMagnitude(uint32_t *q, uint32_t *r, const uint32_t *u, uint32_t nu, const uint32_t *v, uint32_t nv)
+        {
+            if (nv == 1)
+            {
+                uint64_t rem = 0;
+                for (uint32_t i = nu; i-- > 0;)
+                {
+                    uint64_t cur = (rem << 32) | u[i];
+                    q[i] = uint32_t(cur / v[0]);
+                    rem = cur % v[0];
+                }
+                r[0] = uint32_t(rem);
+                return;
+            }
+
+            // Normalization so that the leading limb of the divisor has its top bit set
+            int s = __builtin_clz(v[nv - 1]);
+            Limbs vn(nv), un(nu + 1);
+
+            for (uint32_t i = nv - 1; i > 0; i--)
+                vn.data[i] = uint32_t((uint64_t(v[i]) << s) | (uint64_t(v[i - 1]) >> (32 - s)));
+            vn.data[0] = v[0] << s;
+
+            un.data[nu] = uint32_t(uint64_t(u[nu - 1]) >> (32 - s));
+            for (uint32_t i = nu - 1; i > 0; i--)
+                un.data[i] = uint32_t((uint64_t(u[i]) << s) | (uint64_t(u[i - 1]) >> (32 - s)));
+            un.data[0] = u[0] << s;
+
+            const uint64_t base = uint64_t(1) << 32;
+            for (uint32_t j = nu - nv + 1; j-- > 0;)
+            {
+                // Estimation of the quotient digit, at most one too large
+                uint64_t num = (uint64_t(un.data[j + nv]) << 32) | un.data[j + nv - 1];
+                uint64_t qhat = num / vn.data[nv - 1];
+                uint64_t rhat = num % vn.data[nv - 1];
+
+                while (qhat >= base || qhat * vn.data[nv - 2] > ((rhat << 32) | un.data[j + nv - 2]))
+                {
+                    qhat--;
+                    rhat += vn.data[nv - 1];
+                    if (rhat >= base)
+                        break;
+                }
+
+                // Multiplication and subtraction
+                int64_t k = 0, t;
+                for (uint32_t i = 0; i < nv; i++)
+                {
+                    uint64_t p = qhat * vn.data[i];
+                    t = int64_t(un.data[i + j]) - k - int64_t(p & 0xFFFFFFFFu);
+                    un.data[i + j] = uint32_t(t);
+                    k = int64_t(p >> 32) - (t >> 32);
+                }
+                t = int64_t(un.data[j + nv]) - k;
+                un.data[j + nv] = uint32_t(t);
+
+                q[j] = uint32_t(qhat);
+
+                // Rare case of an estimation one too large: add back
+                if (t < 0)
+                {
+                    q[j]--;
+                    uint64_t carry = 0;
+                    for (uint32_t i = 0; i < nv; i++)
+                    {
+                        carry += uint64_t(un.data[i + j]) + vn.data[i];
+                        un.data[i + j] = uint32_t(carry);
+                        carry >>= 32;
+                    }
+                    un.data[j + nv] += uint32_t(carry);
+                }
+            }
+
+            // Unnormalization of the remainder
+            for (uint32_t i = 0; i < nv; i++)
+                r[i] = uint32_t((uint64_t(un.data[i]) >> s) | (uint64_t(un.data[i + 1]) << (32 - s)));
+        }
+    }
+
+
+    inline BigInt::View::View(const BigInt &value)
+    {
+        if (value.limbs.data != nullptr)
+        {
+            data = value.limbs.data;
+            size = value.limbs.size;
+            negative = value.small < 0;
+        } else {
+            uint64_t m = detail::magnitude(value.small);
+            local[0] = uint32_t(m);
+            local[1] = uint32_t(m >> 32);
+            data = local;
+            size = local[1] != 0 ? 2 : (local[0] != 0 ? 1 : 0);
+            negative = value.small < 0;
+        }
+    }
+
+
+    inline void BigInt::assign(detail::Limbs &&magnitude, bool negative)
+    {
+        magnitude.trim();
+
+        if (magnitude.size <= 2)
+        {
+            uint64_t m = 0;
+            if (magnitude.size > 0) m = magnitude.data[0];
+            if (magnitude.size > 1) m |= uint64_t(magnitude.data[1]) << 32;
+
+            // Inline whenever the value fits, -2^63 included
+            const uint64_t limit = uint64_t(1) << 63;
+            if (m < limit || (negative && m == limit))
+            {
+                small = negative ? int64_t(uint64_t(0) - m) : int64_t(m);
+                limbs = detail::Limbs();
+                return;
+            }
+        }
+
+        limbs = std::move(magnitude);
+        small = negative ? -1 : 1;
+    }
+
+
+    inline BigInt::BigInt() : small(0)
+    {
+    }
+
+
+    template <class I, typename std::enable_if<std::is_integral<I>::value, int>::type>
+    BigInt::BigInt(I value) : small(0)
+    {
+        if (std::is_unsigned<I>::value && uint64_t(value) > uint64_t(std::numeric_limits<int64_t>::max()))
+        {
+            detail::Limbs m(2);
+            m.data[0] = uint32_t(uint64_t(value));
+            m.data[1] = uint32_t(uint64_t(value) >> 32);
+            assign(std::move(m), false);
+        } else
+            small = int64_t(value);
+    }
+
+
+    template <class F, typename std::enable_if<std::is_floating_point<F>::value, int>::type>
+    BigInt::BigInt(F value) : small(0)
+    {
+        assert(std::isfinite(value) && "BigInt from a non finite floating number");
+
+        if (std::fabs(value) < std::ldexp(F(1), 63))
+            small = int64_t(value);
+        else {
+            // value = m * 2^e with 0.5 <= |m| < 1, the 64 leading bits hold the whole mantissa
+            int e;
+            F m = std::frexp(std::fabs(value), &e);
+            *this = BigInt(uint64_t(std::ldexp(m, 64))) << unsigned(e - 64);
+            if (value < 0)
+                *this = -*this;
+        }
+    }
+
+
+    inline BigInt::BigInt(const char *digits) : small(0)
+    {
+        bool negative = false;
+        if (*digits == '-' || *digits == '+')
+            negative = (*digits++ == '-');
+
+        assert(*digits >= '0' && *digits <= '9' && "BigInt from a string without digits");
+
+        // Chunks of 9 digits fit in a limb
+        while (*digits >= '0' && *digits <= '9')
+        {
+            uint32_t chunk = 0, scale = 1;
+            for (int k = 0; k < 9 && *digits >= '0' && *digits <= '9'; k++, digits++)
+            {
+                chunk = chunk * 10 + uint32_t(*digits - '0');
+                scale *= 10;
+            }
+            *this = *this * BigInt(scale) + BigInt(chunk);
+        }
+
+        if (negative)
+            *this = -*this;
+    }
+
+
+    inline BigInt::BigInt(const BigInt &other) : small(other.small)
+    {
+        if (other.limbs.data != nullptr)
+        {
+            limbs = detail::Limbs(other.limbs.size);
+            std::memcpy(limbs.data, other.limbs.data, other.limbs.size * sizeof(uint32_t));
+        }
+    }
+
+
+    inline BigInt::BigInt(BigInt &&other) noexcept : small(other.small), limbs(std::move(other.limbs))
+    {
+        other.small = 0;
+    }
+
+
+    inline BigInt &BigInt::operator=(const BigInt &other)
+    {
+        if (this != &other)
+        {
+            if (other.limbs.data == nullptr)
+                limbs = detail::Limbs();
+            else {
+                if (limbs.capacity < other.limbs.size)
+                    limbs = detail::Limbs(other.limbs.size);
+                limbs.size = other.limbs.size;
+                std::memcpy(limbs.data, other.limbs.data, other.limbs.size * sizeof(uint32_t));
+            }
+            small = other.small;
+        }
+
+        return *this;
+    }
+
+
+    inline BigInt &BigInt::operator=(BigInt &&other) noexcept
+    {
+        if (this != &other)
+        {
+            small = other.small;
+            limbs = std::move(other.limbs);
+            other.small = 0;
+        }
+
+        return *this;
+    }
+
+
+    inline bool BigInt::isSmall() const
+    {
+        return limbs.data == nullptr;
+    }
+
+
+    inline int64_t BigInt::toInt64() const
+    {
+        return small;
+    }
+
+
+    inline int BigInt::sign() const
+    {
+        return (small > 0) - (small < 0);
+    }
+
+
+    inline unsigned int BigInt::bitLength() const
+    {
+        if (limbs.data == nullptr)
+            return small == 0 ? 0 : 64 - __builtin_clzll(detail::magnitude(small));
+
+        return 32 * limbs.size - __builtin_clz(limbs.data[limbs.size - 1]);
+    }
+
+
+    template <class F, typename std::enable_if<std::is_floating_point<F>::value, int>::type>
+    BigInt::operator F() const
+    {
+        if (limbs.data == nullptr)
+            return F(small);
+
+        // 64 leading bits, the lower ones folded into a sticky bit for correct rounding
+        unsigned int low = bitLength() - 64, index = low / 32, offset = low % 32;
+        uint64_t top = 0;
+
+        for (uint32_t k = 0; k < 3 && index + k < limbs.size; k++)
+        {
+            // Bits of limb index + k land at 32 * k - offset
+            int position = 32 * int(k) - int(offset);
+            uint64_t limb = limbs.data[index + k];
+            if (position < 0)
+                top |= limb >> -position;
+            else if (position < 64)
+                top |= limb << position;
+        }
+
+        bool sticky = (limbs.data[index] & ((uint32_t(1) << offset) - 1)) != 0;
+        for (uint32_t i = 0; i < index && !sticky; i++)
+            sticky = limbs.data[i] != 0;
+
+        F value = std::ldexp(F(top | uint64_t(sticky)), int(low));
+        return small < 0 ? -value : value;
+    }
+
+
+    inline std::size_t BigInt::hash() const
+    {
+        if (limbs.data == nullptr)
+            return std::size_t(small);
+
+        std::uint64_t h = std::uint64_t(small);
+        for (uint32_t i = 0; i < limbs.size; i++)
+            h = detail::mixHash(h, limbs.data[i]);
+
+        return std::size_t(h);
+    }
+
+
+    inline std::string BigInt::toString() const
+    {
+        if (limbs.data == nullptr)
+            return std::to_string(small);
+
+        // Chunks of 9 digits, least significant first
+        detail::Limbs m(limbs.size), chunks(limbs.size * 10 / 9 + 2);
+        std::memcpy(m.data, limbs.data, limbs.size * sizeof(uint32_t));
+        uint32_t count = 0;
+
+        while (m.size > 0)
+        {
+            uint64_t rem = 0;
+            for (uint32_t i = m.size; i-- > 0;)
+            {
+                uint64_t cur = (rem << 32) | m.data[i];
+                m.data[i] = uint32_t(cur / 1000000000u);
+                rem = cur % 1000000000u;
+            }
+            m.trim();
+            chunks.data[count++] = uint32_t(rem);
+        }
+
+        std::string digits = small < 0 ? "-" : "";
+        digits += std::to_string(chunks.data[count - 1]);
+        for (uint32_t i = count - 1; i-- > 0;)
+        {
+            std::string chunk = std::to_string(chunks.data[i]);
+            digits.append(9 - chunk.size(), '0');
+            digits += chunk;
+        }
+
+        return digits;
+    }
+
+
+    inline BigInt BigInt::addLarge(const BigInt &a, const BigInt &b, bool subtract)
+    {
+        View va(a), vb(b);
+        bool negative_b = vb.negative != subtract;
+        BigInt result;
+
+        if (va.negative == negative_b)
+        {
+            const View &big = va.size >= vb.size ? va : vb, &little = va.size >= vb.size ? vb : va;
+            detail::Limbs r(big.size + 1);
+            detail::addMagnitude(r.data, big.data, big.size, little.data, little.size);
+            result.assign(std::move(r), va.negative);
+        } else {
+            int c = detail::compareMagnitude(va.data, va.size, vb.data, vb.size);
+            if (c == 0)
+                return result;
+
+            const View &big = c > 0 ? va : vb, &little = c > 0 ? vb : va;
+            detail::Limbs r(big.size);
+            detail::subMagnitude(r.data, big.data, big.size, little.data, little.size);
+            result.assign(std::move(r), c > 0 ? va.negative : negative_b);
+        }
+
+        return result;
+    }
+
+
+    inline BigInt BigInt::mulLarge(const BigInt &a, const BigInt &b)
+    {
+        View va(a), vb(b);
+        BigInt result;
+
+        if (va.size == 0 || vb.size == 0)
+            return result;
+
+        detail::Limbs r(va.size + vb.size);
+        detail::mulMagnitude(r.data, va.data, va.size, vb.data, vb.size);
+        result.assign(std::move(r), va.negative != vb.negative);
+
+        return result;
+    }
+
+
+    inline void BigInt::divLarge(const BigInt &a, const BigInt &b, BigInt *quotient, BigInt *remainder)
+    {
+        View va(a), vb(b);
+
+        if (detail::compareMagnitude(va.data, va.size, vb.data, vb.size) < 0)
+        {
+            if (remainder != nullptr) *remainder = a;
+            if (quotient != nullptr) *quotient = BigInt();
+            return;
+        }
+
+        detail::Limbs q(va.size - vb.size + 1), r(vb.size);
+        detail::divMagnitude(q.data, r.data, va.data, va.size, vb.data, vb.size);
+
+        bool negative_a = va.negative, negative_q = va.negative != vb.negative;
+        if (quotient != nullptr) quotient->assign(std::move(q), negative_q);
+        if (remainder != nullptr) remainder->assign(std::move(r), negative_a);
+    }
+
+
+    inline BigInt BigInt::operator-() const
+    {
+        if (limbs.data == nullptr && small != std::numeric_limits<int64_t>::min())
+            return BigInt(-small);
+
+        return addLarge(BigInt(), *this, true);
+    }
+
+
+    inline BigInt &BigInt::operator+=(const BigInt &other)
+    {
+        return *this = *this + other;
+    }
+
+
+    inline BigInt &BigInt::operator-=(const BigInt &other)
+    {
+        return *this = *this - other;
+    }
+
+
+    inline BigInt &BigInt::operator*=(const BigInt &other)
+    {
+        return *this = *this * other;
+    }
+
+
+    inline BigInt &BigInt::operator/=(const BigInt &other)
+    {
+        return *this = *this / other;
+    }
+
+
+    inline BigInt &BigInt::operator%=(const BigInt &other)
+    {
+        return *this = *this % other;
+    }
+
+
+    inline BigInt &BigInt::operator<<=(unsigned int shift)
+    {
+        return *this = *this << shift;
+    }
+
+
+    inline BigInt &BigInt::operator>>=(unsigned int shift)
+    {
+        return *this = *this >> shift;
+    }
+
+
+    inline BigInt operator+(const BigInt &a, const BigInt &b)
+    {
+        int64_t r;
+        if (a.isSmall() && b.isSmall() && !__builtin_add_overflow(a.small, b.small, &r))
+            return BigInt(r);
+
+        return BigInt::addLarge(a, b, false);
+    }
+
+
+    inline BigInt operator-(const BigInt &a, const BigInt &b)
+    {
+        int64_t r;
+        if (a.isSmall() && b.isSmall() && !__builtin_sub_overflow(a.small, b.small, &r))
+            return BigInt(r);
+
+        return BigInt::addLarge(a, b, true);
+    }
+
+
+    inline BigInt operator*(const BigInt &a, const BigInt &b)
+    {
+        int64_t r;
+        if (a.isSmall() && b.isSmall() && !__builtin_mul_overflow(a.small, b.small, &r))
+            return BigInt(r);
+
+        return BigInt::mulLarge(a, b);
+    }
+
+
+    inline BigInt operator/(const BigInt &a, const BigInt &b)
+    {
+        assert(b.sign() != 0 && "Error: division by zero");
+
+        if (a.isSmall() && b.isSmall() && !(b.small == -1 && a.small == std::numeric_limits<int64_t>::min()))
+            return BigInt(a.small / b.small);
+
+        BigInt q;
+        BigInt::divLarge(a, b, &q, nullptr);
+        return q;
+    }
+
+
+    inline BigInt operator%(const BigInt &a, const BigInt &b)
+    {
+        assert(b.sign() != 0 && "Error: division by zero");
+
+        if (a.isSmall() && b.isSmall())
+            return BigInt(b.small == -1 ? 0 : a.small % b.small);
+
+        BigInt r;
+        BigInt::divLarge(a, b, nullptr, &r);
+        return r;
+    }
+
+
+    inline BigInt operator<<(const BigInt &a, unsigned int shift)
+    {
+        if (a.isSmall() && shift < 62)
+        {
+            const int64_t limit = int64_t(1) << (62 - shift);
+            if (a.small < limit && a.small > -limit)
+                return BigInt(int64_t(uint64_t(a.small) << shift));
+        }
+
+        BigInt::View va(a);
+        BigInt result;
+        if (va.size == 0)
+            return result;
+
+        uint32_t limb_shift = shift / 32, bit_shift = shift % 32;
+        detail::Limbs r(va.size + limb_shift + 1);
+        for (uint32_t i = 0; i < va.size; i++)
+        {
+            uint64_t v = uint64_t(va.data[i]) << bit_shift;
+            r.data[i + limb_shift] |= uint32_t(v);
+            r.data[i + limb_shift + 1] |= uint32_t(v >> 32);
+        }
+        result.assign(std::move(r), va.negative);
+
+        return result;
+    }
+
+
+    inline BigInt operator>>(const BigInt &a, unsigned int shift)
+    {
+        if (a.isSmall())
+            return BigInt(shift >= 64 ? (a.small < 0 ? -1 : 0) : (a.small >> shift));
+
+        BigInt::View va(a);
+        BigInt result;
+        uint32_t limb_shift = shift / 32, bit_shift = shift % 32;
+
+        if (limb_shift >= va.size)
+            return BigInt(va.negative ? -1 : 0);
+
+        // Bits shifted out, needed to round negative values toward minus infinity
+        bool dropped = (bit_shift != 0) && (va.data[limb_shift] & ((uint32_t(1) << bit_shift) - 1)) != 0;
+        for (uint32_t i = 0; i < limb_shift && !dropped; i++)
+            dropped = va.data[i] != 0;
+
+        uint32_t n = va.size - limb_shift;
+        detail::Limbs r(n);
+        for (uint32_t i = 0; i < n; i++)
+        {
+            uint64_t v = va.data[i + limb_shift];
+            if (i + limb_shift + 1 < va.size)
+                v |= uint64_t(va.data[i + limb_shift + 1]) << 32;
+            r.data[i] = uint32_t(v >> bit_shift);
+        }
+        result.assign(std::move(r), va.negative);
+
+        if (va.negative && dropped)
+            result -= 1;
+
+        return result;
+    }
+
+
+    inline int BigInt::compare(const BigInt &a, const BigInt &b)
+    {
+        if (a.isSmall() && b.isSmall())
+            return (a.small > b.small) - (a.small < b.small);
+
+        int sa = a.sign(), sb = b.sign();
+        if (sa != sb)
+            return sa < sb ? -1 : 1;
+
+        View va(a), vb(b);
+        int c = detail::compareMagnitude(va.data, va.size, vb.data, vb.size);
+        return sa < 0 ? -c : c;
+    }
+
+
+    inline void BigInt::divmod(const BigInt &a, const BigInt &b, BigInt &quotient, BigInt &remainder)
+    {
+        assert(b.sign() != 0 && "Error: division by zero");
+
+        if (a.isSmall() && b.isSmall() && !(b.small == -1 && a.small == std::numeric_limits<int64_t>::min()))
+        {
+            int64_t q = a.small / b.small, r = a.small % b.small;
+            quotient = BigInt(q);
+            remainder = BigInt(r);
+        } else
+            divLarge(a, b, &quotient, &remainder);
+    }
+
+
+    inline std::ostream &operator<<(std::ostream &o, const BigInt &value)
+    {
+        if (value.isSmall())
+            o << value.small;
+        else
+            o << value.toString();
+
+        return o;
+    }
+
+
+    inline std::istream &operator>>(std::istream &i, BigInt &value)
+    {
+        std::string token;
+
+        if (i >> token)
+        {
+            const char *digits = token.c_str();
+            if (*digits == '-' || *digits == '+')
+                digits++;
+
+            if (*digits < '0' || *digits > '9')
+                i.setstate(std::ios::failbit);
+            else
+                value = BigInt(token.c_str());
+        }
+
+        return i;
+    }
+
+
+    /**
+     * \brief GCD of BigInt: Euclid while the values are large, then binary GCD inline
+     */
+    template <>
+    inline BigInt AutoGCD::compute<BigInt>(BigInt a, BigInt b)
+    {
+        while (!b.isSmall() || !a.isSmall())
+        {
+            if (b.sign() == 0)
+                return abs(a);
+
+            BigInt r = a % b;
+            a = std::move(b);
+            b = std::move(r);
+        }
+
+        return BigInt(uint64_t(BinaryGCD::compute(detail::magnitude(a.toInt64()), detail::magnitude(b.toInt64()))));
+    }
+
+
+    namespace detail
+    {
+        /**
+         * \brief Conversion of an integer to BigInt, 128-bit builtin integers included
+         * \param[in] value The integer
+         * \return The same value as a BigInt
+         */
+        template <class T>
+        BigInt toBigInt(const T &value)
+        {
+            if constexpr (IsBuiltinInteger<T>::value && sizeof(T) > 8)
+            {
+                const T low = T(std::numeric_limits<int64_t>::min()), high = T(std::numeric_limits<int64_t>::max());
+                if (value >= low && value <= high)
+                    return BigInt(int64_t(value));
+
+                // Arithmetic shift: value = high * 2^64 + low with 0 <= low < 2^64
+                return (BigInt(int64_t(value >> 64)) << 64) + BigInt(uint64_t(value));
+            } else
+                return BigInt(value);
+        }
+
+
+        /**
+         * \brief Conversion of a BigInt to an integer type, if it fits
+         * \param[in] value The BigInt
+         * \param[out] result The same value in T, unchanged if it does not fit
+         * \return False if value does not fit in T
+         */
+        template <class T>
+        bool fromBigInt(const BigInt &value, T &result)
+        {
+            if constexpr (!IsBuiltinInteger<T>::value)
+            {
+                result = T(value);
+                return true;
+            } else {
+                if (value.isSmall())
+                {
+                    const int64_t small = value.toInt64();
+                    if constexpr (sizeof(T) < 8)
+                    {
+                        if (small < int64_t(std::numeric_limits<T>::min()) || small > int64_t(std::numeric_limits<T>::max()))
+                            return false;
+                    }
+                    result = T(small);
+                    return true;
+                }
+
+                if constexpr (sizeof(T) <= 8)
+                    return false;
+                else {
+                    typedef typename Unsigned<T>::type U;
+
+                    if (value.bitLength() >= 8 * sizeof(T))
+                        return false;
+
+                    // 32 bits at a time, from the least significant ones
+                    BigInt rest = value.sign() < 0 ? -value : value;
+                    U bits(0);
+                    for (unsigned int shift = 0; shift < 8 * sizeof(T); shift += 32)
+                    {
+                        BigInt high = rest >> 32;
+                        bits |= U((rest - (high << 32)).toInt64()) << shift;
+                        rest = std::move(high);
+                    }
+
+                    result = value.sign() < 0 ? T(U(0) - bits) : T(bits);
+                    return true;
+                }
+            }
+        }
+    }
+}
+
+
+
+/********
+ * Hash *
+ ********/
+namespace std
+{
+    /**
+     * \struct hash<frac::BigInt>
+     * \brief Hash of arbitrary precision integers for unordered containers
+     */
+    template <>
+    struct hash<frac::BigInt>
+    {
+        std::size_t operator()(const frac::BigInt &value) const
+        {
+            return value.hash();
+        }
+    };
+}
+
+
+
+/******************
+ * Type shortcuts *
+ ******************/
+typedef frac::Fraction<frac::BigInt, float> FractionBF;     /*!< Fraction of BigInt whose value is evaluated in float precision */
+typedef frac::Fraction<frac::BigInt, double> FractionBD;    /*!< Fraction of BigInt whose value is evaluated in double precision */
+
+
+#endif  /*_BIGINT_H_*/
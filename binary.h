@@ -0,0 +1,676 @@
+#ifndef _BINARY_H_
+#define _BINARY_H_
+
+/**
+ * \file binary.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Compact binary files of fractions, written by a stream and read in place from a mapped file
+ *
+ * A file starts with an 8 byte header: "FRAC", the version 1, the format,
+ * the size in bytes of T1 and a zero byte. The fractions follow, canonical:
+ * - BinaryFormat::Varint: zigzag varint numerator then varint denominator;
+ * - BinaryFormat::SharedDenominator: blocks made of a varint denominator, a
+ *   varint count, then as many zigzag varint numerators over that denominator;
+ * - BinaryFormat::Fixed: little endian numerator then denominator of the size
+ *   of T1, allowing random access.
+ * Varints are little endian groups of 7 bits, the high bit set on all but the
+ * last byte.
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "fraction.h"
+#include "mapped.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /**
+     * \enum BinaryFormat
+     * \brief Encodings of the fractions of a binary file, see binary.h
+     */
+    enum class BinaryFormat : unsigned char
+    {
+        Varint = 0,             /*!< Variable length terms, the smallest for general data */
+        SharedDenominator = 1,  /*!< Runs of equal denominators stored once */
+        Fixed = 2               /*!< Terms of the size of T1, random access */
+    };
+
+
+    /**
+     * \class BinaryWriter
+     * \brief Streaming writer of a binary file of fractions
+     *
+     * The encoded fractions are buffered and handed to the stream in large
+     * writes. In BinaryFormat::SharedDenominator, consecutive fractions with
+     * the same denominator form a block of at most blockSize fractions.
+     */
+    template <class T1, class T2, class Policy = DefaultPolicy>
+    class BinaryWriter
+    {
+        static_assert(detail::IsBuiltinInteger<T1>::value, "Binary files need builtin integer terms");
+
+    private:
+        typedef typename detail::Unsigned<T1>::type U;
+
+        std::ostream &stream;       /*!< Destination of the bytes */
+        std::vector<char> buffer;   /*!< Bytes not flushed yet, in [0, used) */
+        std::size_t used;           /*!< Number of bytes in the buffer */
+        BinaryFormat format;        /*!< Encoding of the fractions */
+        T1 blockDenom;              /*!< Denominator of the pending block */
+        std::vector<T1> block;      /*!< Numerators of the pending block */
+
+        /**
+         * \brief Room in the buffer, flushed if needed
+         * \param[in] bytes Number of bytes about to be written
+         * \return Where to write them
+         */
+        char *room(std::size_t bytes);
+
+        /**
+         * \brief Encoding of the pending block in the buffer
+         */
+        void writeBlock();
+
+    public:
+        static const std::size_t blockSize = 4096;  /*!< Maximal number of fractions of a block */
+
+        /**
+         * \brief Constructor, writes the header
+         * \param[in] o Destination stream, opened in binary mode
+         * \param[in] f Encoding of the fractions
+         * \param[in] capacity Size of the buffer in bytes
+         */
+        explicit BinaryWriter(std::ostream &o, BinaryFormat f = BinaryFormat::Varint, std::size_t capacity = std::size_t(1) << 20);
+
+        BinaryWriter(const BinaryWriter &) = delete;
+        BinaryWriter &operator=(const BinaryWriter &) = delete;
+
+        /**
+         * \brief Destructor, flushes the buffer
+         */
+        ~BinaryWriter();
+
+        /**
+         * \brief Writing of a fraction
+         * \param[in] value The fraction
+         */
+        void write(const Fraction<T1, T2, Policy> &value);
+
+        /**
+         * \brief Writing of a range of fractions
+         * \param[in] first Beginning of the range
+         * \param[in] last End of the range
+         */
+        template <class InputIt>
+        void write(InputIt first, InputIt last);
+
+        /**
+         * \brief Transfer of the buffer to the stream, closing the pending block
+         */
+        void flush();
+    };
+
+
+    /**
+     * \class BinaryReader
+     * \brief Reader of a binary file of fractions, mapped in memory
+     *
+     * Nothing is decoded in advance: the iterators walk the mapped bytes and
+     * a fraction is only built when dereferenced. The file must have been
+     * written by BinaryWriter with the same T1; truncated or out of range
+     * terms throw std::runtime_error.
+     */
+    template <class T1, class T2, class Policy = DefaultPolicy>
+    class BinaryReader
+    {
+        static_assert(detail::IsBuiltinInteger<T1>::value, "Binary files need builtin integer terms");
+
+    private:
+        MappedFile file;        /*!< The mapped file */
+        BinaryFormat encoding;  /*!< Encoding of the fractions */
+
+    public:
+        /**
+         * \class const_iterator
+         * \brief Forward iterator decoding the fractions on access
+         */
+        class const_iterator
+        {
+        private:
+            const char *cursor;         /*!< Encoding of the current fraction */
+            const char *end;            /*!< End of the file */
+            BinaryFormat encoding;      /*!< Encoding of the fractions */
+            T1 denom;                   /*!< Denominator of the current block */
+            std::size_t remaining;      /*!< Fractions left in the current block, current one included */
+
+            /**
+             * \brief Reading of the next block header if the current block is over, throws if the file ends inside a block
+             */
+            void enter();
+
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef Fraction<T1, T2, Policy> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const Fraction<T1, T2, Policy> *pointer;
+            typedef Fraction<T1, T2, Policy> reference;
+
+            /**
+             * \brief Constructor
+             * \param[in] first Encoding of the first fraction, or of the first block header
+             * \param[in] last End of the file
+             * \param[in] f Encoding of the fractions
+             */
+            const_iterator(const char *first, const char *last, BinaryFormat f);
+
+            /**
+             * \brief Decoding of the current fraction
+             * \return The fraction
+             */
+            Fraction<T1, T2, Policy> operator*() const;
+
+            const_iterator &operator++();
+            const_iterator operator++(int);
+            bool operator==(const const_iterator &it) const;
+            bool operator!=(const const_iterator &it) const;
+        };
+
+        /**
+         * \brief Constructor, maps the file and checks its header
+         * \param[in] path Path of the file
+         *
+         * Throws std::runtime_error if the file cannot be opened or is not a
+         * binary file of fractions for T1.
+         */
+        explicit BinaryReader(const std::string &path);
+
+        /**
+         * \brief Encoding getter
+         * \return The encoding of the fractions of the file
+         */
+        BinaryFormat format() const;
+
+        /**
+         * \brief Number of fractions
+         * \return The size of the file in fractions, counted by a scan unless the format is fixed
+         */
+        std::size_t size() const;
+
+        /**
+         * \brief Fraction at a position, for BinaryFormat::Fixed only
+         * \param[in] i The position
+         * \return The i-th fraction of the file
+         */
+        Fraction<T1, T2, Policy> operator[](std::size_t i) const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+    };
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    namespace detail
+    {
+        /**
+         * \brief Size of the header of a binary file
+         */
+        const std::size_t binaryHeader = 8;
+
+
+        /**
+         * \brief Maximal size of the varint of an unsigned integer
+         */
+        template <class U>
+        constexpr std::size_t varintBytes()
+        {
+            return (8 * sizeof(U) + 6) / 7;
+        }
+
+
+        /**
+         * \brief Zigzag encoding, mapping 0, -1, 1, -2... to 0, 1, 2, 3...
+         */
+        template <class T>
+        constexpr typename Unsigned<T>::type zigzag(T value)
+        {
+            typedef typename Unsigned<T>::type U;
+            return U(U(value) << 1) ^ (value < T(0) ? U(~U(0)) : U(0));
+        }
+
+
+        /**
+         * \brief Zigzag decoding, inverse of zigzag()
+         */
+        template <class T>
+        constexpr T unzigzag(typename Unsigned<T>::type value)
+        {
+            typedef typename Unsigned<T>::type U;
+            return T(U(value >> 1) ^ U(U(0) - (value & U(1))));
+        }
+
+
+        /**
+         * \brief Encoding of a varint
+         * \param[out] p Destination, with room for varintBytes<U>() bytes
+         * \param[in] value The integer
+         * \return Past the written bytes
+         */
+        template <class U>
+        char *writeVarint(char *p, U value)
+        {
+            while (value >= U(0x80))
+            {
+                *p++ = char((unsigned(value) & 0x7F) | 0x80);
+                value >>= 7;
+            }
+            *p++ = char(value);
+
+            return p;
+        }
+
+
+        /**
+         * \brief Decoding of a varint
+         * \param[in] p Beginning of the varint
+         * \param[in] end End of the data
+         * \param[out] value The integer
+         * \return Past the varint, nullptr if it is truncated or does not fit in U
+         */
+        template <class U>
+        const char *readVarint(const char *p, const char *end, U &value)
+        {
+            const unsigned int bits = 8 * sizeof(U);
+            U result(0);
+            for (unsigned int shift = 0; p != end; shift += 7)
+            {
+                const unsigned int byte = static_cast<unsigned char>(*p++);
+                if (shift >= bits || (shift > 0 && (U(byte & 0x7F) >> (bits - shift)) != U(0)))
+                    return nullptr;
+
+                result |= U(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                {
+                    value = result;
+                    return p;
+                }
+            }
+
+            return nullptr;
+        }
+
+
+        /**
+         * \brief Skipping of a varint
+         * \return Past the varint, nullptr if it is truncated
+         */
+        inline const char *skipVarint(const char *p, const char *end)
+        {
+            while (p != end && (*p & 0x80) != 0)
+                ++p;
+
+            return p == end ? nullptr : p + 1;
+        }
+
+
+        /**
+         * \brief Encoding of a little endian integer of the size of T
+         */
+        template <class T>
+        char *writeFixed(char *p, T value)
+        {
+            typedef typename Unsigned<T>::type U;
+            U bits = U(value);
+            for (std::size_t k = 0; k < sizeof(T); k++)
+            {
+                *p++ = char(unsigned(bits) & 0xFF);
+                bits = U(bits >> 8);
+            }
+
+            return p;
+        }
+
+
+        /**
+         * \brief Decoding of a little endian integer of the size of T
+         */
+        template <class T>
+        T readFixed(const char *p)
+        {
+            typedef typename Unsigned<T>::type U;
+            U bits(0);
+            for (std::size_t k = 0; k < sizeof(T); k++)
+                bits |= U(static_cast<unsigned char>(p[k])) << (8 * k);
+
+            return T(bits);
+        }
+
+
+        /**
+         * \brief Error on invalid data of a binary file
+         */
+        [[noreturn]] inline void corruptBinary()
+        {
+            throw std::runtime_error("frac::BinaryReader: truncated or corrupted file");
+        }
+
+
+        /**
+         * \brief Decoding of a varint denominator
+         * \param[in,out] p Position of the varint, moved past it
+         * \param[in] end End of the data
+         * \return The denominator, positive and within T1
+         */
+        template <class T1>
+        T1 readDenominator(const char *&p, const char *end)
+        {
+            typename Unsigned<T1>::type d(0);
+            p = readVarint(p, end, d);
+            if (p == nullptr || d == 0 || d > typename Unsigned<T1>::type(largest<T1>()))
+                corruptBinary();
+
+            return T1(d);
+        }
+    }
+
+
+    template <class T1, class T2, class Policy>
+    BinaryWriter<T1, T2, Policy>::BinaryWriter(std::ostream &o, BinaryFormat f, std::size_t capacity)
+        : stream(o), buffer(capacity < 256 ? 256 : capacity), used(0), format(f), blockDenom(1)
+    {
+        const char header[detail::binaryHeader] = {'F', 'R', 'A', 'C', 1, char(f), char(sizeof(T1)), 0};
+        std::copy(header, header + detail::binaryHeader, buffer.data());
+        used = detail::binaryHeader;
+
+        if (format == BinaryFormat::SharedDenominator)
+            block.reserve(blockSize);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    BinaryWriter<T1, T2, Policy>::~BinaryWriter()
+    {
+        this->flush();
+    }
+
+
+    template <class T1, class T2, class Policy>
+    char *BinaryWriter<T1, T2, Policy>::room(std::size_t bytes)
+    {
+        if (buffer.size() - used < bytes)
+        {
+            stream.write(buffer.data(), std::streamsize(used));
+            used = 0;
+        }
+
+        return buffer.data() + used;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void BinaryWriter<T1, T2, Policy>::writeBlock()
+    {
+        if (block.empty())
+            return;
+
+        char *p = this->room(2 * detail::varintBytes<U>());
+        p = detail::writeVarint(p, U(blockDenom));
+        p = detail::writeVarint(p, U(block.size()));
+        used = std::size_t(p - buffer.data());
+
+        for (const T1 &num : block)
+        {
+            p = this->room(detail::varintBytes<U>());
+            p = detail::writeVarint(p, detail::zigzag(num));
+            used = std::size_t(p - buffer.data());
+        }
+
+        block.clear();
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void BinaryWriter<T1, T2, Policy>::write(const Fraction<T1, T2, Policy> &value)
+    {
+        const T1 num = value.getNum(), denom = value.getDenom();
+
+        char *p = nullptr;
+        switch (format)
+        {
+            case BinaryFormat::Varint:
+                p = this->room(2 * detail::varintBytes<U>());
+                p = detail::writeVarint(p, detail::zigzag(num));
+                p = detail::writeVarint(p, U(denom));
+                break;
+
+            case BinaryFormat::SharedDenominator:
+                if (denom != blockDenom || block.size() == blockSize)
+                {
+                    this->writeBlock();
+                    blockDenom = denom;
+                }
+                block.push_back(num);
+                return;
+
+            case BinaryFormat::Fixed:
+                p = this->room(2 * sizeof(T1));
+                p = detail::writeFixed(p, num);
+                p = detail::writeFixed(p, denom);
+                break;
+        }
+
+        used = std::size_t(p - buffer.data());
+    }
+
+
+    template <class T1, class T2, class Policy>
+    template <class InputIt>
+    void BinaryWriter<T1, T2, Policy>::write(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            this->write(*first);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void BinaryWriter<T1, T2, Policy>::flush()
+    {
+        this->writeBlock();
+
+        if (used > 0)
+            stream.write(buffer.data(), std::streamsize(used));
+        used = 0;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    BinaryReader<T1, T2, Policy>::const_iterator::const_iterator(const char *first, const char *last, BinaryFormat f)
+        : cursor(first), end(last), encoding(f), denom(1), remaining(0)
+    {
+        this->enter();
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void BinaryReader<T1, T2, Policy>::const_iterator::enter()
+    {
+        if (encoding != BinaryFormat::SharedDenominator)
+            return;
+
+        while (remaining == 0 && cursor != end)
+        {
+            denom = detail::readDenominator<T1>(cursor, end);
+            cursor = detail::readVarint(cursor, end, remaining);
+            if (cursor == nullptr)
+                detail::corruptBinary();
+        }
+
+        // The file ends inside a block, the fractions left are lost
+        if (cursor == end && remaining > 0)
+            detail::corruptBinary();
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Fraction<T1, T2, Policy> BinaryReader<T1, T2, Policy>::const_iterator::operator*() const
+    {
+        typedef typename detail::Unsigned<T1>::type U;
+
+        T1 num(0), d(denom);
+        if (encoding == BinaryFormat::Fixed)
+        {
+            num = detail::readFixed<T1>(cursor);
+            d = detail::readFixed<T1>(cursor + sizeof(T1));
+            if (d <= T1(0))
+                detail::corruptBinary();
+        } else {
+            U bits(0);
+            const char *p = detail::readVarint(cursor, end, bits);
+            if (p == nullptr)
+                detail::corruptBinary();
+            num = detail::unzigzag<T1>(bits);
+
+            if (encoding == BinaryFormat::Varint)
+                d = detail::readDenominator<T1>(p, end);
+        }
+
+        // Written in canonical form
+        if constexpr (Policy::reduction::lazy)
+            return Fraction<T1, T2, Policy>(num, d);
+        else
+            return Fraction<T1, T2, Policy>(num, d, irreducible);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    typename BinaryReader<T1, T2, Policy>::const_iterator &BinaryReader<T1, T2, Policy>::const_iterator::operator++()
+    {
+        switch (encoding)
+        {
+            case BinaryFormat::Varint:
+                cursor = detail::skipVarint(cursor, end);
+                if (cursor != nullptr)
+                    cursor = detail::skipVarint(cursor, end);
+                break;
+
+            case BinaryFormat::SharedDenominator:
+                cursor = detail::skipVarint(cursor, end);
+                remaining--;
+                break;
+
+            case BinaryFormat::Fixed:
+                cursor += 2 * sizeof(T1);
+                break;
+        }
+
+        if (cursor == nullptr)
+            detail::corruptBinary();
+        this->enter();
+
+        return *this;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    typename BinaryReader<T1, T2, Policy>::const_iterator BinaryReader<T1, T2, Policy>::const_iterator::operator++(int)
+    {
+        const_iterator it = *this;
+        ++*this;
+        return it;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    bool BinaryReader<T1, T2, Policy>::const_iterator::operator==(const const_iterator &it) const
+    {
+        return cursor == it.cursor;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    bool BinaryReader<T1, T2, Policy>::const_iterator::operator!=(const const_iterator &it) const
+    {
+        return cursor != it.cursor;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    BinaryReader<T1, T2, Policy>::BinaryReader(const std::string &path)
+        : file(path), encoding(BinaryFormat::Varint)
+    {
+        const char *header = file.data();
+        if (file.size() < detail::binaryHeader || std::string(header, 4) != "FRAC" || header[4] != 1)
+            throw std::runtime_error("frac::BinaryReader: not a binary file of fractions " + path);
+
+        encoding = BinaryFormat(header[5]);
+        if (encoding != BinaryFormat::Varint && encoding != BinaryFormat::SharedDenominator && encoding != BinaryFormat::Fixed)
+            throw std::runtime_error("frac::BinaryReader: unknown format in " + path);
+
+        // Varint terms are checked on decoding, fixed ones must have the size of T1
+        if (encoding == BinaryFormat::Fixed
+            && (std::size_t(header[6]) != sizeof(T1) || (file.size() - detail::binaryHeader) % (2 * sizeof(T1)) != 0))
+            throw std::runtime_error("frac::BinaryReader: terms of another size in " + path);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    BinaryFormat BinaryReader<T1, T2, Policy>::format() const
+    {
+        return encoding;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::size_t BinaryReader<T1, T2, Policy>::size() const
+    {
+        if (encoding == BinaryFormat::Fixed)
+            return (file.size() - detail::binaryHeader) / (2 * sizeof(T1));
+
+        return std::size_t(std::distance(this->begin(), this->end()));
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Fraction<T1, T2, Policy> BinaryReader<T1, T2, Policy>::operator[](std::size_t i) const
+    {
+        assertm(encoding == BinaryFormat::Fixed, "Random access needs BinaryFormat::Fixed");
+        return *const_iterator(file.data() + detail::binaryHeader + 2 * sizeof(T1) * i, file.data() + file.size(), encoding);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    typename BinaryReader<T1, T2, Policy>::const_iterator BinaryReader<T1, T2, Policy>::begin() const
+    {
+        return const_iterator(file.data() + detail::binaryHeader, file.data() + file.size(), encoding);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    typename BinaryReader<T1, T2, Policy>::const_iterator BinaryReader<T1, T2, Policy>::end() const
+    {
+        return const_iterator(file.data() + file.size(), file.data() + file.size(), encoding);
+    }
+}
+
+
+#endif  /*_BINARY_H_*/
@@ -0,0 +1,528 @@
+#ifndef _CHARCONV_H_
+#define _CHARCONV_H_
+
+/**
+ * \file charconv.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Conversions between fractions and character sequences, without locale nor allocation
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+
+#include "fraction.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /**
+     * \struct from_chars_result
+     * \brief Result of from_chars(), as std::from_chars_result
+     */
+    struct from_chars_result
+    {
+        const char *ptr;    /*!< Past the parsed characters, or position of the error */
+        std::errc ec;       /*!< std::errc() on success */
+    };
+
+
+    /**
+     * \brief Parsing of a fraction, in the manner of std::from_chars
+     * \param[in] first Beginning of the characters
+     * \param[in] last End of the characters
+     * \param[out] value The parsed fraction, unchanged on error
+     * \param[in] decimal Whether decimal and scientific notations are accepted
+     * \return Past the parsed characters and std::errc() on success; else the
+     * position of the error and std::errc::invalid_argument (no digits, zero
+     * denominator) or std::errc::result_out_of_range (overflow of T1)
+     *
+     * Accepted forms are "a/b", "-a/b", integers "a" and "-a", and if decimal
+     * is true, "-1.25", ".5" or "3e-2". As std::from_chars, leading spaces
+     * and '+' are not accepted.
+     */
+    template <class T1, class T2, class Policy>
+    from_chars_result from_chars(const char *first, const char *last, Fraction<T1, T2, Policy> &value, bool decimal = true);
+
+
+    /**
+     * \struct to_chars_result
+     * \brief Result of to_chars(), as std::to_chars_result
+     */
+    struct to_chars_result
+    {
+        char *ptr;      /*!< Past the written characters, or last on error */
+        std::errc ec;   /*!< std::errc() on success */
+    };
+
+
+    /**
+     * \enum Format
+     * \brief Textual representations of a fraction given by to_chars()
+     */
+    enum class Format
+    {
+        Ratio,      /*!< "-7/2", or "-3" for integers, as operator<< */
+        Mixed,      /*!< "-3 1/2", integer part followed by a proper fraction */
+        Decimal     /*!< "-3.500000", fixed number of digits rounded half away from zero */
+    };
+
+
+    /**
+     * \brief Formatting of a fraction, in the manner of std::to_chars
+     * \param[in] first Beginning of the destination
+     * \param[in] last End of the destination
+     * \param[in] value The fraction to be written
+     * \param[in] format The representation
+     * \param[in] precision Number of digits after the decimal point, for Format::Decimal
+     * \return Past the written characters and std::errc() on success; else
+     * last and std::errc::value_too_large, the destination holding unspecified
+     * characters
+     *
+     * Nothing is allocated and no locale is looked up. The characters are not
+     * terminated by '\0'.
+     */
+    template <class T1, class T2, class Policy>
+    to_chars_result to_chars(char *first, char *last, const Fraction<T1, T2, Policy> &value,
+                             Format format = Format::Ratio, unsigned int precision = 6);
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    namespace detail
+    {
+        /**
+         * \brief Tells whether a character is a decimal digit
+         */
+        constexpr bool isDigit(char c)
+        {
+            return c >= '0' && c <= '9';
+        }
+
+
+        /**
+         * \brief Multiplication and addition on the magnitude of an integer, with overflow check
+         * \param[in,out] value The magnitude, unchanged on overflow
+         * \param[in] factor The factor
+         * \param[in] term The term to be added
+         * \return False on overflow of U
+         */
+        template <class U>
+        constexpr bool mulAdd(U &value, unsigned int factor, unsigned int term)
+        {
+            if constexpr (IsBuiltinInteger<U>::value)
+            {
+                U tmp = 0;
+                if (__builtin_mul_overflow(value, U(factor), &tmp) || __builtin_add_overflow(tmp, U(term), &tmp))
+                    return false;
+                value = tmp;
+            } else
+                value = value * U(factor) + U(term);
+
+            return true;
+        }
+
+
+        /**
+         * \brief Multiplication by a power of ten, with overflow check
+         * \param[in,out] value The integer to be multiplied
+         * \param[in] exponent The non negative power of ten
+         * \return False on overflow of U
+         */
+        template <class U>
+        constexpr bool mulPow10(U &value, long long exponent)
+        {
+            for (; exponent > 0 && value != U(0); exponent--)
+            {
+                if (!mulAdd(value, 10u, 0u))
+                    return false;
+            }
+
+            return true;
+        }
+
+
+        /**
+         * \brief Parsing of the digits of an unsigned integer
+         * \param[in] first Beginning of the characters
+         * \param[in] last End of the characters
+         * \param[out] value The magnitude, accumulated in U
+         * \param[out] overflow Set if the magnitude does not fit in U
+         * \return Past the digits
+         */
+        template <class U>
+        constexpr const char *parseDigits(const char *first, const char *last, U &value, bool &overflow)
+        {
+            for (; first != last && isDigit(*first); ++first)
+            {
+                if (!overflow && !mulAdd(value, 10u, unsigned(*first - '0')))
+                    overflow = true;
+            }
+
+            return first;
+        }
+
+
+        /**
+         * \brief Signed value of a magnitude, if it fits
+         * \param[in] magnitude The magnitude
+         * \param[in] negative The sign
+         * \param[out] value The signed integer
+         * \return False if the value does not fit in T1
+         */
+        template <class T1, class U>
+        constexpr bool toSigned(const U &magnitude, bool negative, T1 &value)
+        {
+            if constexpr (IsBuiltinInteger<T1>::value)
+            {
+                const U limit = U(largest<T1>());
+                if (magnitude > limit && !(negative && magnitude - limit == U(1)))
+                    return false;
+                value = negative ? T1(U(0) - magnitude) : T1(magnitude);
+            } else
+                value = negative ? -T1(magnitude) : T1(magnitude);
+
+            return true;
+        }
+    }
+
+
+    template <class T1, class T2, class Policy>
+    from_chars_result from_chars(const char *first, const char *last, Fraction<T1, T2, Policy> &value, bool decimal)
+    {
+        typedef typename detail::Unsigned<T1>::type U;
+
+        const char *p = first;
+        bool negative = false, overflow = false;
+        if (p != last && *p == '-')
+        {
+            negative = true;
+            ++p;
+        }
+
+        // Integer part, as num * 10^scale: zeros are only applied before a non zero digit.
+        // The digits go to the widest integer, decimals fitting in U once reduced.
+        typedef typename detail::ExpansionInteger<T1>::type W;
+        W num(0);
+        long long scale = 0;
+        const char *digits = p;
+        for (; p != last && detail::isDigit(*p); ++p)
+        {
+            if (*p == '0')
+                scale++;
+            else if (!overflow && !(detail::mulPow10(num, scale + 1) && detail::mulAdd(num, 1u, unsigned(*p - '0'))))
+                overflow = true;
+            else
+                scale = 0;
+        }
+        bool any = p != digits;
+
+        // Fraction bar, or decimal point and exponent
+        U denom(1);
+        if (any && p != last && *p == '/')
+        {
+            const char *bar = p;
+            digits = ++p;
+            denom = U(0);
+
+            if (!overflow && !detail::mulPow10(num, scale))
+                overflow = true;
+            scale = 0;
+
+            // Own flag, so that the denominator is still accumulated after an overflow of the numerator
+            bool large = false;
+            p = detail::parseDigits(p, last, denom, large);
+
+            if (p == digits)
+            {
+                // "a/" parses as "a", as std::from_chars stops on the first invalid character
+                p = bar;
+                denom = U(1);
+            } else if (denom == U(0) && !large)
+                return {digits, std::errc::invalid_argument};
+            overflow = overflow || large;
+        } else if (decimal) {
+            if (p != last && *p == '.')
+            {
+                const char *point = p;
+                digits = ++p;
+
+                // The j-th digit after the point weighs 10^-j
+                long long position = 0;
+                for (; p != last && detail::isDigit(*p); ++p)
+                {
+                    position--;
+                    if (*p == '0')
+                        continue;
+
+                    if (!overflow && !(detail::mulPow10(num, scale - position) && detail::mulAdd(num, 1u, unsigned(*p - '0'))))
+                        overflow = true;
+                    scale = position;
+                }
+
+                if (p == digits && !any)
+                    p = point;
+                else
+                    any = true;
+            }
+
+            if (any && p != last && (*p == 'e' || *p == 'E'))
+            {
+                const char *mark = p++;
+                bool negativeExponent = false;
+                if (p != last && (*p == '-' || *p == '+'))
+                    negativeExponent = *p++ == '-';
+
+                unsigned int exponent = 0;
+                bool large = false;
+                digits = p;
+                p = detail::parseDigits(p, last, exponent, large);
+
+                if (p == digits)
+                    p = mark;   // "1e" parses as "1"
+                else if (large && num != W(0))
+                    overflow = true;
+                else
+                    scale += negativeExponent ? -(long long) exponent : (long long) exponent;
+            }
+        }
+
+        if (!any)
+            return {first, std::errc::invalid_argument};
+
+        // Net power of ten applied once, 10^-s being reduced against the factors 2 and 5 of num
+        if (!overflow && num != W(0) && scale > 0)
+            overflow = !detail::mulPow10(num, scale);
+        else if (!overflow && num != W(0) && scale < 0)
+        {
+            long long twos = -scale, fives = -scale;
+            for (; twos > 0 && num % W(2) == W(0); twos--)
+                num /= W(2);
+            for (; fives > 0 && num % W(5) == W(0); fives--)
+                num /= W(5);
+
+            for (; twos > 0 && !overflow; twos--)
+                overflow = !detail::mulAdd(denom, 2u, 0u);
+            for (; fives > 0 && !overflow; fives--)
+                overflow = !detail::mulAdd(denom, 5u, 0u);
+        }
+
+        if (overflow || W(U(num)) != num)
+            return {first, std::errc::result_out_of_range};
+
+        // Decimal terms may not fit in T1 even though the reduced ones do
+        const U magnitude(num);
+        T1 n(0), d(1);
+        if (!detail::toSigned(magnitude, negative, n) || !detail::toSigned(denom, false, d))
+        {
+            U g = Policy::gcd::compute(magnitude, denom);
+            if (!detail::toSigned(U(magnitude / g), negative, n) || !detail::toSigned(U(denom / g), false, d))
+                return {first, std::errc::result_out_of_range};
+        }
+
+        value = Fraction<T1, T2, Policy>(n, d);
+        return {p, std::errc()};
+    }
+
+    namespace detail
+    {
+        /**
+         * \brief Writing of the decimal digits of an unsigned integer
+         * \param[in] first Beginning of the destination
+         * \param[in] last End of the destination
+         * \param[in] value The integer
+         * \return Past the digits, nullptr if they do not fit
+         */
+        template <class U>
+        char *writeDigits(char *first, char *last, U value)
+        {
+            if constexpr (IsBuiltinInteger<U>::value)
+            {
+                // Two digits per division, from the least significant ones
+                static const char pairs[] = "0001020304050607080910111213141516171819"
+                                            "2021222324252627282930313233343536373839"
+                                            "4041424344454647484950515253545556575859"
+                                            "6061626364656667686970717273747576777879"
+                                            "8081828384858687888990919293949596979899";
+                char digits[40];
+                char *end = digits + sizeof(digits), *p = end;
+                while (value >= U(100))
+                {
+                    unsigned int pair = unsigned(value % U(100));
+                    value /= U(100);
+                    p -= 2;
+                    std::memcpy(p, pairs + 2 * pair, 2);
+                }
+                if (value >= U(10))
+                {
+                    p -= 2;
+                    std::memcpy(p, pairs + 2 * unsigned(value), 2);
+                } else
+                    *--p = char('0' + unsigned(value));
+
+                std::size_t count = std::size_t(end - p);
+                if (std::size_t(last - first) < count)
+                    return nullptr;
+                std::memcpy(first, p, count);
+                return first + count;
+            } else {
+                // Arbitrary precision: digits are written backwards then reversed
+                char *p = first;
+                do
+                {
+                    if (p == last)
+                        return nullptr;
+
+                    U digit = value % U(10);
+                    int c = 0;
+                    while (U(c) != digit)
+                        c++;
+                    *p++ = char('0' + c);
+                    value /= U(10);
+                } while (value != U(0));
+
+                std::reverse(first, p);
+                return p;
+            }
+        }
+
+
+        /**
+         * \brief Next digit of the decimal expansion of a proper fraction
+         * \param[in,out] rem The remainder r, replaced by 10 * r mod d
+         * \param[in] denom The denominator d
+         * \return The digit 10 * r / d
+         *
+         * Computed by ten additions modulo d, so that 10 * r cannot overflow U.
+         */
+        template <class U>
+        constexpr unsigned int nextDigit(U &rem, const U &denom)
+        {
+            const U gap = denom - rem;
+            U acc(0);
+            unsigned int digit = 0;
+            for (int i = 0; i < 10; i++)
+            {
+                if (acc >= gap)
+                {
+                    acc -= gap;
+                    digit++;
+                } else
+                    acc += rem;
+            }
+
+            rem = acc;
+            return digit;
+        }
+    }
+
+
+    template <class T1, class T2, class Policy>
+    to_chars_result to_chars(char *first, char *last, const Fraction<T1, T2, Policy> &value, Format format, unsigned int precision)
+    {
+        typedef typename detail::Unsigned<T1>::type U;
+
+        const T1 num = value.getNum(), denom = value.getDenom();
+        const U n = detail::magnitude(num), d = detail::magnitude(denom);
+        const to_chars_result failure = {last, std::errc::value_too_large};
+
+        char *p = first;
+        if (num < T1(0))
+        {
+            if (p == last)
+                return failure;
+            *p++ = '-';
+        }
+
+        if (format == Format::Ratio || (format == Format::Mixed && d == U(1)))
+        {
+            if ((p = detail::writeDigits(p, last, n)) == nullptr)
+                return failure;
+            if (d != U(1))
+            {
+                if (p == last)
+                    return failure;
+                *p++ = '/';
+                if ((p = detail::writeDigits(p, last, d)) == nullptr)
+                    return failure;
+            }
+            return {p, std::errc()};
+        }
+
+        U quotient = n / d, rem = n % d;
+        if (format == Format::Mixed)
+        {
+            if (quotient != U(0))
+            {
+                if ((p = detail::writeDigits(p, last, quotient)) == nullptr || p == last)
+                    return failure;
+                *p++ = ' ';
+            }
+            if ((p = detail::writeDigits(p, last, rem)) == nullptr || p == last)
+                return failure;
+            *p++ = '/';
+            if ((p = detail::writeDigits(p, last, d)) == nullptr)
+                return failure;
+            return {p, std::errc()};
+        }
+
+        // Decimal expansion by long division
+        char *integer = p;
+        if ((p = detail::writeDigits(p, last, quotient)) == nullptr)
+            return failure;
+        if (precision > 0)
+        {
+            if (std::size_t(last - p) <= precision)
+                return failure;
+            *p++ = '.';
+            for (unsigned int i = 0; i < precision; i++)
+                *p++ = char('0' + detail::nextDigit(rem, d));
+        }
+
+        // Rounding half away from zero, the carry going up to the integer part
+        if (rem >= d - rem)
+        {
+            char *q = p;
+            while (q != integer)
+            {
+                --q;
+                if (*q == '.')
+                    continue;
+                if (*q != '9')
+                {
+                    ++*q;
+                    break;
+                }
+                *q = '0';
+            }
+
+            if (q == integer && *q == '0')
+            {
+                if (p == last)
+                    return failure;
+                std::memmove(integer + 1, integer, std::size_t(p - integer));
+                *integer = '1';
+                ++p;
+            }
+        }
+
+        return {p, std::errc()};
+    }
+}
+
+
+#endif  /*_CHARCONV_H_*/
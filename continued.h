@@ -0,0 +1,932 @@
+#ifndef _CONTINUED_H_
+#define _CONTINUED_H_
+
+/**
+ * \file continued.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Lazy continued fraction expansions and Gosper's arithmetic on them
+ */
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+#include "fraction.h"
+#include "bigint.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /*
+     * An expansion is any class with a term_type typedef and a method
+     * bool next(term_type &term), giving the partial quotients one at a time
+     * and false once the expansion is over. An empty expansion is infinity.
+     * The first quotient is floor(x), the next ones are positive.
+     */
+
+    /**
+     * \class RationalExpansion
+     * \brief Partial quotients of a rational, by Euclid's algorithm
+     */
+    template <class T1>
+    class RationalExpansion
+    {
+    public:
+        typedef T1 term_type;   /*!< Type of the partial quotients */
+
+    private:
+        T1 num;     /*!< Numerator of the remainder */
+        T1 denom;   /*!< Denominator of the remainder, 0 once over */
+
+    public:
+        /**
+         * \brief Constructor
+         * \param[in] frac The expanded fraction
+         */
+        template <class T2, class Policy>
+        explicit RationalExpansion(const Fraction<T1, T2, Policy> &frac);
+
+        /**
+         * \brief Next partial quotient
+         * \param[out] term The quotient
+         * \return False if the expansion is over
+         */
+        bool next(T1 &term);
+    };
+
+
+    /**
+     * \class FloatingExpansion
+     * \brief Partial quotients of a floating number
+     *
+     * As the floating constructor of Fraction, the expansion stops on the
+     * first convergent equal to the number, and before a convergent whose
+     * terms do not fit in T1.
+     */
+    template <class T1, class T2>
+    class FloatingExpansion
+    {
+    public:
+        typedef T1 term_type;   /*!< Type of the partial quotients */
+
+    private:
+        T2 x;           /*!< The expanded number */
+        T2 alpha;       /*!< Complete quotient */
+        T2 p0, p1;      /*!< Last two convergent numerators */
+        T2 q0, q1;      /*!< Last two convergent denominators */
+        int step;       /*!< Quotients given so far, -1 once over */
+
+    public:
+        /**
+         * \brief Constructor
+         * \param[in] floating_number The finite number, whose floor must fit in T1
+         *
+         * Throws std::overflow_error if the floor of the number does not fit in T1.
+         */
+        explicit FloatingExpansion(T2 floating_number);
+
+        /**
+         * \brief Next partial quotient
+         * \param[out] term The quotient
+         * \return False if the expansion is over
+         */
+        bool next(T1 &term);
+    };
+
+
+    /**
+     * \class SqrtExpansion
+     * \brief Periodic partial quotients of the square root of an integer
+     *
+     * The expansion is infinite unless the integer is a perfect square.
+     */
+    template <class T1>
+    class SqrtExpansion
+    {
+    public:
+        typedef T1 term_type;   /*!< Type of the partial quotients */
+
+    private:
+        T1 n;       /*!< The integer */
+        T1 root;    /*!< floor(sqrt(n)) */
+        T1 m;       /*!< Complete quotient (m + sqrt(n)) / d */
+        T1 d;       /*!< Denominator of the complete quotient, 0 once over */
+        T1 a;       /*!< Next partial quotient */
+
+    public:
+        /**
+         * \brief Constructor
+         * \param[in] number The nonnegative integer
+         */
+        explicit SqrtExpansion(T1 number);
+
+        /**
+         * \brief Next partial quotient
+         * \param[out] term The quotient
+         * \return False if the expansion is over
+         */
+        bool next(T1 &term);
+    };
+
+
+    namespace detail
+    {
+        /**
+         * \class NoExpansion
+         * \brief Expansion over from the start, for the unused input of a homographic function
+         */
+        template <class I>
+        struct NoExpansion
+        {
+            typedef I term_type;    /*!< Type of the partial quotients */
+
+            bool next(I &) { return false; }
+        };
+    }
+
+
+    /**
+     * \class Gosper
+     * \brief Lazy expansion of (axy + bx + cy + d) / (exy + fx + gy + h) by Gosper's algorithm
+     *
+     * The terms of x and y are taken only as long as the next quotient of the
+     * result is unknown, so that a consumer reading n quotients does not pay
+     * for the full expansions of the operands. Coefficients of integer type
+     * I, unbounded by default.
+     *
+     * A rational result of irrational operands, as sqrt(2) * sqrt(2), is
+     * never reached: patience bounds the number of terms taken in a row
+     * without a new quotient, after which the expansion is cut.
+     */
+    template <class X, class Y, class I = BigInt>
+    class Gosper
+    {
+    public:
+        typedef I term_type;    /*!< Type of the partial quotients */
+
+    private:
+        X x;                        /*!< First operand */
+        Y y;                        /*!< Second operand */
+        std::array<I, 8> k;         /*!< Coefficients a, b, c, d over e, f, g, h */
+        bool overX, overY;          /*!< Operands whose expansion is over */
+        bool takenX, takenY;        /*!< Operands whose first quotient is taken */
+        bool turnX;                 /*!< Operand taken next when both go on */
+        std::size_t patience;       /*!< Maximal terms taken in a row, 0 for no bound */
+        bool cut;                   /*!< Whether the expansion was cut by patience */
+
+        /**
+         * \brief Substitution of x = q + 1/x', or of x = infinity once over
+         */
+        void takeX();
+
+        /**
+         * \brief Substitution of y = q + 1/y', or of y = infinity once over
+         */
+        void takeY();
+
+        /**
+         * \brief Quotient common to the whole range of the operands, if any
+         * \param[out] term The quotient
+         * \return True if the quotient is known
+         */
+        bool known(I &term) const;
+
+    public:
+        /**
+         * \brief Constructor
+         * \param[in] first Expansion of x
+         * \param[in] second Expansion of y
+         * \param[in] coefficients Coefficients a, b, c, d, e, f, g, h
+         * \param[in] patience Maximal terms taken in a row, 0 for no bound
+         */
+        Gosper(X first, Y second, const std::array<I, 8> &coefficients, std::size_t patience = 0);
+
+        /**
+         * \brief Next partial quotient
+         * \param[out] term The quotient
+         * \return False if the expansion is over or cut
+         */
+        bool next(I &term);
+
+        /**
+         * \brief Tells whether the expansion was cut by patience
+         * \return True if the quotients given are only those of an approximation
+         */
+        bool truncated() const;
+    };
+
+
+    /**
+     * \class QuotientRange
+     * \brief Lazy range over the partial quotients of an expansion
+     *
+     * Each begin() restarts from a copy of the expansion, so that the range
+     * can be walked several times.
+     */
+    template <class Expansion>
+    class QuotientRange
+    {
+    private:
+        Expansion expansion;    /*!< The expansion, as given */
+
+    public:
+        typedef typename Expansion::term_type term_type;    /*!< Type of the partial quotients */
+
+        /**
+         * \class const_iterator
+         * \brief Input iterator computing the quotients on increment
+         */
+        class const_iterator
+        {
+        private:
+            Expansion expansion;    /*!< Remaining expansion */
+            term_type term;         /*!< Current quotient */
+            bool over;              /*!< Whether the iterator is past the end */
+
+        public:
+            typedef std::input_iterator_tag iterator_category;
+            typedef term_type value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const term_type *pointer;
+            typedef const term_type &reference;
+
+            /**
+             * \brief Constructor
+             * \param[in] e The expansion
+             * \param[in] end Whether the iterator is the end
+             */
+            const_iterator(const Expansion &e, bool end);
+
+            const term_type &operator*() const;
+            const_iterator &operator++();
+            const_iterator operator++(int);
+            bool operator==(const const_iterator &it) const;
+            bool operator!=(const const_iterator &it) const;
+        };
+
+        /**
+         * \brief Constructor
+         * \param[in] e The expansion
+         */
+        explicit QuotientRange(const Expansion &e);
+
+        const_iterator begin() const;
+        const_iterator end() const;
+    };
+
+
+    /**
+     * \class ConvergentRange
+     * \brief Lazy range over the convergents of an expansion
+     */
+    template <class Expansion, class T2 = double>
+    class ConvergentRange
+    {
+    private:
+        Expansion expansion;    /*!< The expansion, as given */
+
+    public:
+        typedef typename Expansion::term_type term_type;    /*!< Type of the partial quotients */
+        typedef Fraction<term_type, T2> value_type;         /*!< Type of the convergents */
+
+        /**
+         * \class const_iterator
+         * \brief Input iterator computing the convergents on increment
+         */
+        class const_iterator
+        {
+        private:
+            Expansion expansion;    /*!< Remaining expansion */
+            term_type p0, p1;       /*!< Last two numerators */
+            term_type q0, q1;       /*!< Last two denominators */
+            bool over;              /*!< Whether the iterator is past the end */
+
+            /**
+             * \brief Next convergent, p_n = a_n p_(n-1) + p_(n-2) and so for q
+             */
+            void advance();
+
+        public:
+            typedef std::input_iterator_tag iterator_category;
+            typedef Fraction<term_type, T2> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const value_type *pointer;
+            typedef value_type reference;
+
+            /**
+             * \brief Constructor
+             * \param[in] e The expansion
+             * \param[in] end Whether the iterator is the end
+             */
+            const_iterator(const Expansion &e, bool end);
+
+            value_type operator*() const;
+            const_iterator &operator++();
+            const_iterator operator++(int);
+            bool operator==(const const_iterator &it) const;
+            bool operator!=(const const_iterator &it) const;
+        };
+
+        /**
+         * \brief Constructor
+         * \param[in] e The expansion
+         */
+        explicit ConvergentRange(const Expansion &e);
+
+        const_iterator begin() const;
+        const_iterator end() const;
+    };
+
+
+    /**
+     * \brief Expansion of a fraction
+     * \param[in] frac The fraction
+     * \return Its lazy expansion
+     */
+    template <class T1, class T2, class Policy>
+    RationalExpansion<T1> expand(const Fraction<T1, T2, Policy> &frac);
+
+    /**
+     * \brief Expansion of a floating number, see FloatingExpansion
+     * \param[in] floating_number The number
+     * \return Its lazy expansion, with quotients of type T1
+     */
+    template <class T1, class T2>
+    FloatingExpansion<T1, T2> expand(T2 floating_number);
+
+    /**
+     * \brief Range over the partial quotients of an expansion
+     * \param[in] expansion The expansion
+     * \return The lazy range
+     */
+    template <class Expansion>
+    QuotientRange<Expansion> quotients(const Expansion &expansion);
+
+    /**
+     * \brief Range over the convergents of an expansion
+     * \param[in] expansion The expansion
+     * \return The lazy range, of fractions with the floating type T2
+     *
+     * The convergents are computed in the type of the quotients: use an
+     * unbounded type for long expansions of irrationals.
+     */
+    template <class T2 = double, class Expansion>
+    ConvergentRange<Expansion, T2> convergents(const Expansion &expansion);
+
+    /**
+     * \brief Convergent at a given depth
+     * \param[in] expansion The expansion
+     * \param[in] depth Number of quotients taken, the whole expansion by default
+     * \return The convergent, or the value if the expansion is shorter
+     */
+    template <class T2 = double, class Expansion>
+    Fraction<typename Expansion::term_type, T2> toFraction(Expansion expansion, std::size_t depth = std::size_t(-1));
+
+    /**
+     * \brief Lazy (a x + b) / (c x + d)
+     * \param[in] x Expansion of x
+     * \param[in] a, b, c, d The coefficients
+     * \param[in] patience See Gosper
+     * \return The lazy expansion of the result
+     */
+    template <class I = BigInt, class X>
+    Gosper<X, detail::NoExpansion<I>, I> gosperTransform(X x, const I &a, const I &b, const I &c, const I &d, std::size_t patience = 0);
+
+    /**
+     * \brief Lazy x + y
+     */
+    template <class I = BigInt, class X, class Y>
+    Gosper<X, Y, I> gosperAdd(X x, Y y, std::size_t patience = 0);
+
+    /**
+     * \brief Lazy x - y
+     */
+    template <class I = BigInt, class X, class Y>
+    Gosper<X, Y, I> gosperSub(X x, Y y, std::size_t patience = 0);
+
+    /**
+     * \brief Lazy x * y
+     */
+    template <class I = BigInt, class X, class Y>
+    Gosper<X, Y, I> gosperMul(X x, Y y, std::size_t patience = 0);
+
+    /**
+     * \brief Lazy x / y
+     */
+    template <class I = BigInt, class X, class Y>
+    Gosper<X, Y, I> gosperDiv(X x, Y y, std::size_t patience = 0);
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    namespace detail
+    {
+        /**
+         * \brief Quotient rounded toward minus infinity
+         * \param[in] num Numerator
+         * \param[in] denom Nonzero denominator
+         */
+        template <class I>
+        I floorRatio(I num, I denom)
+        {
+            if (denom < I(0))
+            {
+                num = -num;
+                denom = -denom;
+            }
+
+            I q = num / denom;
+            if (num < I(0) && q * denom != num)
+                q -= I(1);
+            return q;
+        }
+    }
+
+
+    template <class T1>
+    template <class T2, class Policy>
+    RationalExpansion<T1>::RationalExpansion(const Fraction<T1, T2, Policy> &frac)
+        : num(frac.getNum()), denom(frac.getDenom())
+    {
+    }
+
+
+    template <class T1>
+    bool RationalExpansion<T1>::next(T1 &term)
+    {
+        if (denom == T1(0))
+            return false;
+
+        term = detail::floorRatio(num, denom);
+        const T1 rest = num - term * denom;
+        num = denom;
+        denom = rest;
+
+        return true;
+    }
+
+
+    template <class T1, class T2>
+    FloatingExpansion<T1, T2>::FloatingExpansion(T2 floating_number)
+        : x(floating_number), alpha(floating_number), p0(0), p1(1), q0(1), q1(0), step(0)
+    {
+        assertm(floating_number == floating_number, "Cannot expand NaN");
+
+        const T1 max_numerator = detail::largest<T1>();
+        if (max_numerator > 0 && !(detail::floorOf(x) < T2(max_numerator) && detail::floorOf(x) > -T2(max_numerator)))
+            throw std::overflow_error("frac::FloatingExpansion: value out of range");
+    }
+
+
+    template <class T1, class T2>
+    bool FloatingExpansion<T1, T2>::next(T1 &term)
+    {
+        if (step < 0)
+            return false;
+
+        const T2 quotient = detail::floorOf(alpha);
+        const T2 p2 = quotient * p1 + p0, q2 = quotient * q1 + q0;
+
+        // Stop before the convergent that does not fit
+        const T1 max_numerator = detail::largest<T1>();
+        if (max_numerator > 0 && !((p2 < 0 ? -p2 : p2) < T2(max_numerator) && q2 < T2(max_numerator)))
+        {
+            step = -1;
+            return false;
+        }
+
+        term = T1(quotient);
+        p0 = p1;
+        p1 = p2;
+        q0 = q1;
+        q1 = q2;
+
+        const T2 theta = alpha - quotient;
+        if (theta == 0 || p1 / q1 == x || ++step >= 4 * std::numeric_limits<T2>::digits)
+            step = -1;
+        else
+            alpha = 1 / theta;
+
+        return true;
+    }
+
+
+    template <class T1>
+    SqrtExpansion<T1>::SqrtExpansion(T1 number)
+        : n(number), root(T1(std::sqrt((long double) number))), m(0), d(1), a(0)
+    {
+        assertm(number >= 0, "Cannot expand the square root of a negative number");
+
+        while (root * root > n)
+            root--;
+        while ((root + 1) * (root + 1) <= n)
+            root++;
+
+        a = root;
+    }
+
+
+    template <class T1>
+    bool SqrtExpansion<T1>::next(T1 &term)
+    {
+        if (d == T1(0))
+            return false;
+
+        term = a;
+        m = d * a - m;
+        d = (n - m * m) / d;    // Exact, and 0 only for a perfect square
+        if (d != T1(0))
+            a = (root + m) / d;
+
+        return true;
+    }
+
+
+    template <class X, class Y, class I>
+    Gosper<X, Y, I>::Gosper(X first, Y second, const std::array<I, 8> &coefficients, std::size_t patience)
+        : x(first), y(second), k(coefficients), overX(false), overY(false), takenX(false), takenY(false),
+          turnX(true), patience(patience), cut(false)
+    {
+    }
+
+
+    template <class X, class Y, class I>
+    void Gosper<X, Y, I>::takeX()
+    {
+        typename X::term_type term;
+        takenX = true;
+
+        if (!x.next(term))
+        {
+            // x = infinity: only the terms in x remain, if any
+            overX = true;
+            if (k[0] != I(0) || k[1] != I(0) || k[4] != I(0) || k[5] != I(0))
+                k = {I(0), I(0), k[0], k[1], I(0), I(0), k[4], k[5]};
+            return;
+        }
+
+        const I q(term);
+        k = {k[0] * q + k[2], k[1] * q + k[3], k[0], k[1],
+             k[4] * q + k[6], k[5] * q + k[7], k[4], k[5]};
+    }
+
+
+    template <class X, class Y, class I>
+    void Gosper<X, Y, I>::takeY()
+    {
+        typename Y::term_type term;
+        takenY = true;
+
+        if (!y.next(term))
+        {
+            // y = infinity: only the terms in y remain, if any
+            overY = true;
+            if (k[0] != I(0) || k[2] != I(0) || k[4] != I(0) || k[6] != I(0))
+                k = {I(0), k[0], I(0), k[2], I(0), k[4], I(0), k[6]};
+            return;
+        }
+
+        const I q(term);
+        k = {k[0] * q + k[1], k[0], k[2] * q + k[3], k[2],
+             k[4] * q + k[5], k[4], k[6] * q + k[7], k[6]};
+    }
+
+
+    template <class X, class Y, class I>
+    bool Gosper<X, Y, I>::known(I &term) const
+    {
+        // Operands still raw may be anything, afterwards they lie in [1, infinity]
+        if (!(takenX || overX) || !(takenY || overY))
+            return false;
+
+        // The result is monotonic in x and y when no denominator vanishes, so
+        // its range is bounded by the ratios at the corners, 0 and infinity
+        bool found = false;
+        int sign = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            const I &num = k[i], &denom = k[i + 4];
+            if (denom == I(0))
+            {
+                if (num == I(0))
+                    continue;   // Corner unused, or limit between the others
+                return false;
+            }
+
+            const int s = denom < I(0) ? -1 : 1;
+            if (sign != 0 && s != sign)
+                return false;
+            sign = s;
+
+            const I q = detail::floorRatio(num, denom);
+            if (found && q != term)
+                return false;
+            term = q;
+            found = true;
+        }
+
+        return found;
+    }
+
+
+    template <class X, class Y, class I>
+    bool Gosper<X, Y, I>::next(I &term)
+    {
+        std::size_t taken = 0;
+        for (;;)
+        {
+            if (k[4] == I(0) && k[5] == I(0) && k[6] == I(0) && k[7] == I(0))
+                return false;   // Infinity
+
+            if (this->known(term))
+            {
+                // z = term + 1/z'
+                k = {k[4], k[5], k[6], k[7],
+                     k[0] - term * k[4], k[1] - term * k[5], k[2] - term * k[6], k[3] - term * k[7]};
+                return true;
+            }
+
+            if (overX && overY)
+                return false;   // Only for degenerate coefficients
+
+            if (patience != 0 && taken++ == patience)
+            {
+                cut = true;
+                k = {I(0), I(0), I(0), I(0), I(0), I(0), I(0), I(0)};
+                return false;
+            }
+
+            // Operands taken in turn
+            if (overY || (!overX && turnX))
+                this->takeX();
+            else
+                this->takeY();
+            turnX = !turnX;
+        }
+    }
+
+
+    template <class X, class Y, class I>
+    bool Gosper<X, Y, I>::truncated() const
+    {
+        return cut;
+    }
+
+
+    template <class Expansion>
+    QuotientRange<Expansion>::const_iterator::const_iterator(const Expansion &e, bool end)
+        : expansion(e), term(), over(end)
+    {
+        if (!over)
+            ++*this;
+    }
+
+
+    template <class Expansion>
+    const typename QuotientRange<Expansion>::term_type &QuotientRange<Expansion>::const_iterator::operator*() const
+    {
+        return term;
+    }
+
+
+    template <class Expansion>
+    typename QuotientRange<Expansion>::const_iterator &QuotientRange<Expansion>::const_iterator::operator++()
+    {
+        over = !expansion.next(term);
+        return *this;
+    }
+
+
+    template <class Expansion>
+    typename QuotientRange<Expansion>::const_iterator QuotientRange<Expansion>::const_iterator::operator++(int)
+    {
+        const_iterator it = *this;
+        ++*this;
+        return it;
+    }
+
+
+    template <class Expansion>
+    bool QuotientRange<Expansion>::const_iterator::operator==(const const_iterator &it) const
+    {
+        // Input iterators: only the end is compared
+        return over && it.over;
+    }
+
+
+    template <class Expansion>
+    bool QuotientRange<Expansion>::const_iterator::operator!=(const const_iterator &it) const
+    {
+        return !(*this == it);
+    }
+
+
+    template <class Expansion>
+    QuotientRange<Expansion>::QuotientRange(const Expansion &e)
+        : expansion(e)
+    {
+    }
+
+
+    template <class Expansion>
+    typename QuotientRange<Expansion>::const_iterator QuotientRange<Expansion>::begin() const
+    {
+        return const_iterator(expansion, false);
+    }
+
+
+    template <class Expansion>
+    typename QuotientRange<Expansion>::const_iterator QuotientRange<Expansion>::end() const
+    {
+        return const_iterator(expansion, true);
+    }
+
+
+    template <class Expansion, class T2>
+    ConvergentRange<Expansion, T2>::const_iterator::const_iterator(const Expansion &e, bool end)
+        : expansion(e), p0(0), p1(1), q0(1), q1(0), over(end)
+    {
+        if (!over)
+            this->advance();
+    }
+
+
+    template <class Expansion, class T2>
+    void ConvergentRange<Expansion, T2>::const_iterator::advance()
+    {
+        term_type a;
+        if (!expansion.next(a))
+        {
+            over = true;
+            return;
+        }
+
+        term_type p2 = a * p1 + p0, q2 = a * q1 + q0;
+        p0 = p1;
+        p1 = p2;
+        q0 = q1;
+        q1 = q2;
+    }
+
+
+    template <class Expansion, class T2>
+    typename ConvergentRange<Expansion, T2>::value_type ConvergentRange<Expansion, T2>::const_iterator::operator*() const
+    {
+        // Convergents are irreducible with a positive denominator
+        return value_type(p1, q1, irreducible);
+    }
+
+
+    template <class Expansion, class T2>
+    typename ConvergentRange<Expansion, T2>::const_iterator &ConvergentRange<Expansion, T2>::const_iterator::operator++()
+    {
+        this->advance();
+        return *this;
+    }
+
+
+    template <class Expansion, class T2>
+    typename ConvergentRange<Expansion, T2>::const_iterator ConvergentRange<Expansion, T2>::const_iterator::operator++(int)
+    {
+        const_iterator it = *this;
+        this->advance();
+        return it;
+    }
+
+
+    template <class Expansion, class T2>
+    bool ConvergentRange<Expansion, T2>::const_iterator::operator==(const const_iterator &it) const
+    {
+        return over && it.over;
+    }
+
+
+    template <class Expansion, class T2>
+    bool ConvergentRange<Expansion, T2>::const_iterator::operator!=(const const_iterator &it) const
+    {
+        return !(*this == it);
+    }
+
+
+    template <class Expansion, class T2>
+    ConvergentRange<Expansion, T2>::ConvergentRange(const Expansion &e)
+        : expansion(e)
+    {
+    }
+
+
+    template <class Expansion, class T2>
+    typename ConvergentRange<Expansion, T2>::const_iterator ConvergentRange<Expansion, T2>::begin() const
+    {
+        return const_iterator(expansion, false);
+    }
+
+
+    template <class Expansion, class T2>
+    typename ConvergentRange<Expansion, T2>::const_iterator ConvergentRange<Expansion, T2>::end() const
+    {
+        return const_iterator(expansion, true);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    RationalExpansion<T1> expand(const Fraction<T1, T2, Policy> &frac)
+    {
+        return RationalExpansion<T1>(frac);
+    }
+
+
+    template <class T1, class T2>
+    FloatingExpansion<T1, T2> expand(T2 floating_number)
+    {
+        return FloatingExpansion<T1, T2>(floating_number);
+    }
+
+
+    template <class Expansion>
+    QuotientRange<Expansion> quotients(const Expansion &expansion)
+    {
+        return QuotientRange<Expansion>(expansion);
+    }
+
+
+    template <class T2, class Expansion>
+    ConvergentRange<Expansion, T2> convergents(const Expansion &expansion)
+    {
+        return ConvergentRange<Expansion, T2>(expansion);
+    }
+
+
+    template <class T2, class Expansion>
+    Fraction<typename Expansion::term_type, T2> toFraction(Expansion expansion, std::size_t depth)
+    {
+        typedef typename Expansion::term_type I;
+
+        I p0(0), p1(1), q0(1), q1(0), a;
+        for (std::size_t i = 0; i < depth && expansion.next(a); i++)
+        {
+            I p2 = a * p1 + p0, q2 = a * q1 + q0;
+            p0 = p1;
+            p1 = p2;
+            q0 = q1;
+            q1 = q2;
+        }
+
+        assertm(q1 != I(0), "Empty expansion, infinite value");
+        return Fraction<I, T2>(p1, q1, irreducible);
+    }
+
+
+    template <class I, class X>
+    Gosper<X, detail::NoExpansion<I>, I> gosperTransform(X x, const I &a, const I &b, const I &c, const I &d, std::size_t patience)
+    {
+        return Gosper<X, detail::NoExpansion<I>, I>(x, detail::NoExpansion<I>(),
+            {I(0), a, I(0), b, I(0), c, I(0), d}, patience);
+    }
+
+
+    template <class I, class X, class Y>
+    Gosper<X, Y, I> gosperAdd(X x, Y y, std::size_t patience)
+    {
+        return Gosper<X, Y, I>(x, y, {I(0), I(1), I(1), I(0), I(0), I(0), I(0), I(1)}, patience);
+    }
+
+
+    template <class I, class X, class Y>
+    Gosper<X, Y, I> gosperSub(X x, Y y, std::size_t patience)
+    {
+        return Gosper<X, Y, I>(x, y, {I(0), I(1), I(-1), I(0), I(0), I(0), I(0), I(1)}, patience);
+    }
+
+
+    template <class I, class X, class Y>
+    Gosper<X, Y, I> gosperMul(X x, Y y, std::size_t patience)
+    {
+        return Gosper<X, Y, I>(x, y, {I(1), I(0), I(0), I(0), I(0), I(0), I(0), I(1)}, patience);
+    }
+
+
+    template <class I, class X, class Y>
+    Gosper<X, Y, I> gosperDiv(X x, Y y, std::size_t patience)
+    {
+        return Gosper<X, Y, I>(x, y, {I(0), I(1), I(0), I(0), I(0), I(0), I(1), I(0)}, patience);
+    }
+}
+
+
+#endif  /*_CONTINUED_H_*/
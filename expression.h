@@ -0,0 +1,584 @@
+#ifndef _EXPRESSION_H_
+#define _EXPRESSION_H_
+
+/**
+ * \file expression.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Expression templates evaluating a whole rational expression with a single reduction
+ */
+
+#include <type_traits>
+
+#include "fraction.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    namespace detail
+    {
+        /**
+         * \class Leaf
+         * \brief Expression made of a fraction, held by reference
+         */
+        template <class F>
+        class Leaf
+        {
+        private:
+            const F &value;     /*!< The fraction */
+
+        public:
+            typedef F fraction_type;    /*!< Type of the result */
+
+            constexpr explicit Leaf(const F &frac);
+
+            /**
+             * \brief Unreduced value of the expression
+             * \param[out] n Numerator
+             * \param[out] d Denominator, positive
+             * \param[in,out] overflow Set on overflow of I
+             */
+            template <class I, class A>
+            constexpr void terms(I &n, I &d, bool &overflow) const;
+
+            /**
+             * \brief Value of the expression computed with the operators of Fraction
+             */
+            constexpr F eager() const;
+        };
+
+
+        /**
+         * \class Constant
+         * \brief Expression made of an integer, held by value
+         */
+        template <class F>
+        class Constant
+        {
+        private:
+            typename F::integer_type value;     /*!< The integer */
+
+        public:
+            typedef F fraction_type;    /*!< Type of the result */
+
+            constexpr explicit Constant(typename F::integer_type number);
+
+            template <class I, class A>
+            constexpr void terms(I &n, I &d, bool &overflow) const;
+
+            constexpr F eager() const;
+        };
+
+
+        /**
+         * \class Negation
+         * \brief Expression -E
+         */
+        template <class E>
+        class Negation
+        {
+        private:
+            E operand;  /*!< The negated expression */
+
+        public:
+            typedef typename E::fraction_type fraction_type;    /*!< Type of the result */
+
+            constexpr explicit Negation(const E &e);
+
+            template <class I, class A>
+            constexpr void terms(I &n, I &d, bool &overflow) const;
+
+            constexpr fraction_type eager() const;
+        };
+
+
+        /**
+         * \class Binary
+         * \brief Expression L op R, for op among Add, Sub, Mul and Div
+         */
+        template <Operation op, class L, class R>
+        class Binary
+        {
+        private:
+            L left;     /*!< Left operand */
+            R right;    /*!< Right operand */
+
+        public:
+            typedef typename L::fraction_type fraction_type;    /*!< Type of the result */
+
+            constexpr Binary(const L &l, const R &r);
+
+            template <class I, class A>
+            constexpr void terms(I &n, I &d, bool &overflow) const;
+
+            constexpr fraction_type eager() const;
+        };
+    }
+
+
+    /**
+     * \class Expression
+     * \brief Rational expression captured by the operators, evaluated on conversion
+     *
+     * The tree of the expression is computed on unreduced numerators and
+     * denominators, in the wider builtin type of T1 if any (see Fraction) with
+     * overflow checks, then reduced once. If an intermediate overflows or the
+     * result does not fit in T1, the expression is computed again with the
+     * operators of Fraction, so that the policy applies as without expression
+     * templates.
+     *
+     * Leaves refer to the fractions given to expr(): an expression is meant
+     * to be converted within the statement that builds it, not stored.
+     */
+    template <class E>
+    class Expression
+    {
+    private:
+        E node;     /*!< Root of the tree */
+
+    public:
+        typedef typename E::fraction_type fraction_type;    /*!< Type of the result */
+
+        /**
+         * \brief Constructor
+         * \param[in] root Root of the tree
+         */
+        constexpr explicit Expression(const E &root);
+
+        /**
+         * \brief Root getter
+         * \return The root of the tree
+         */
+        constexpr const E &root() const;
+
+        /**
+         * \brief Evaluation with a single reduction
+         * \return The value of the expression
+         */
+        constexpr fraction_type eval() const;
+
+        /**
+         * \brief Conversion to a fraction, see eval()
+         */
+        constexpr operator fraction_type() const;
+    };
+
+
+    /**
+     * \brief Start of an expression
+     * \param[in] frac A fraction, which must outlive the expression
+     * \return The expression made of frac alone
+     *
+     * Only operators with an expression operand are captured: every eager
+     * operation of a formula has to involve one, as in
+     * expr(a) * b + expr(c) * d - e.
+     */
+    template <class T1, class T2, class Policy>
+    constexpr Expression<detail::Leaf<Fraction<T1, T2, Policy>>> expr(const Fraction<T1, T2, Policy> &frac);
+
+
+    namespace detail
+    {
+        /**
+         * \brief Tells whether a type is an Expression
+         */
+        template <class T>
+        struct IsExpression
+        {
+            static const bool value = false;
+        };
+
+        template <class E>
+        struct IsExpression<Expression<E>>
+        {
+            static const bool value = true;
+        };
+
+
+        /**
+         * \brief Node of an operand of an expression whose result is of type F
+         *
+         * The operand may be an Expression, a fraction of type F or an integer.
+         */
+        template <class X, class F, class = void>
+        struct Operand
+        {
+            typedef Constant<F> type;
+            static constexpr type node(const X &x) { return type(typename F::integer_type(x)); }
+        };
+
+        template <class E, class F>
+        struct Operand<Expression<E>, F, void>
+        {
+            typedef E type;
+            static constexpr const E &node(const Expression<E> &x) { return x.root(); }
+        };
+
+        template <class F>
+        struct Operand<F, F, void>
+        {
+            typedef Leaf<F> type;
+            static constexpr type node(const F &x) { return type(x); }
+        };
+
+
+        /**
+         * \brief Type of the result of an operation with at least one Expression operand
+         */
+        template <class L, class R, bool = IsExpression<L>::value || IsExpression<R>::value>
+        struct ExpressionResult
+        {
+            static const bool valid = false;
+        };
+
+        template <class L, class R>
+        struct ExpressionResult<L, R, true>
+        {
+        private:
+            typedef typename std::conditional<IsExpression<L>::value, L, R>::type E;
+            typedef typename E::fraction_type F;
+            typedef typename F::integer_type T1;
+
+            template <class X>
+            static constexpr bool operand()
+            {
+                return IsExpression<X>::value || std::is_same<X, F>::value
+                       || std::is_integral<X>::value || std::is_same<X, T1>::value;
+            }
+
+        public:
+            static const bool valid = operand<L>() && operand<R>();
+
+            template <Operation op>
+            using type = Expression<Binary<op, typename Operand<L, F>::type, typename Operand<R, F>::type>>;
+
+            template <Operation op>
+            static constexpr type<op> make(const L &l, const R &r)
+            {
+                typedef typename Operand<L, F>::type NL;
+                typedef typename Operand<R, F>::type NR;
+                return type<op>(Binary<op, NL, NR>(Operand<L, F>::node(l), Operand<R, F>::node(r)));
+            }
+        };
+    }
+
+
+    /**
+     * \brief Capture of a sum with an expression, a fraction or an integer
+     */
+    template <class L, class R, typename std::enable_if<detail::ExpressionResult<L, R>::valid, int>::type = 0>
+    constexpr auto operator+(const L &l, const R &r);
+
+    /**
+     * \brief Capture of a difference with an expression, a fraction or an integer
+     */
+    template <class L, class R, typename std::enable_if<detail::ExpressionResult<L, R>::valid, int>::type = 0>
+    constexpr auto operator-(const L &l, const R &r);
+
+    /**
+     * \brief Capture of a product with an expression, a fraction or an integer
+     */
+    template <class L, class R, typename std::enable_if<detail::ExpressionResult<L, R>::valid, int>::type = 0>
+    constexpr auto operator*(const L &l, const R &r);
+
+    /**
+     * \brief Capture of a quotient with an expression, a fraction or an integer
+     */
+    template <class L, class R, typename std::enable_if<detail::ExpressionResult<L, R>::valid, int>::type = 0>
+    constexpr auto operator/(const L &l, const R &r);
+
+    /**
+     * \brief Capture of the opposite of an expression
+     */
+    template <class E>
+    constexpr Expression<detail::Negation<E>> operator-(const Expression<E> &e);
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    namespace detail
+    {
+        /**
+         * \brief Integer type of unreduced terms computed from T1
+         *
+         * The wider builtin type of T1 if any, else T1 itself.
+         */
+        template <class T1>
+        struct Accumulator
+        {
+        private:
+            typedef typename Wider<T1>::type W;
+
+        public:
+            typedef typename std::conditional<std::is_void<W>::value, T1, W>::type type;
+        };
+
+
+        /**
+         * \brief Single reduction of unreduced terms into a fraction
+         * \param[in] n Numerator
+         * \param[in] d Denominator, positive
+         * \param[out] value The reduced fraction, unchanged on failure
+         * \return False if the reduced terms do not fit in T1
+         */
+        template <class F, class I>
+        constexpr bool narrow(I n, I d, F &value)
+        {
+            typedef typename F::integer_type T1;
+            typedef typename F::policy_type Policy;
+
+            if constexpr (!IsBuiltinInteger<T1>::value)
+            {
+                // Arbitrary precision: the constructor reduces
+                value = F(T1(n), T1(d));
+                return true;
+            } else {
+                I g = Policy::gcd::compute(n, d);
+                if (g > 1) {
+                    n /= g;
+                    d /= g;
+                }
+
+                const I lowest(std::numeric_limits<T1>::min()), highest(std::numeric_limits<T1>::max());
+                if (n < lowest || n > highest || d > highest)
+                    return false;
+
+                if constexpr (Policy::reduction::lazy)
+                    value = F(T1(n), T1(d));
+                else
+                    value = F(T1(n), T1(d), irreducible);
+                return true;
+            }
+        }
+
+
+        template <class F>
+        constexpr Leaf<F>::Leaf(const F &frac)
+            : value(frac)
+        {
+        }
+
+
+        template <class F>
+        template <class I, class A>
+        constexpr void Leaf<F>::terms(I &n, I &d, bool &) const
+        {
+            n = I(value.getNum());
+            d = I(value.getDenom());
+        }
+
+
+        template <class F>
+        constexpr F Leaf<F>::eager() const
+        {
+            return value;
+        }
+
+
+        template <class F>
+        constexpr Constant<F>::Constant(typename F::integer_type number)
+            : value(number)
+        {
+        }
+
+
+        template <class F>
+        template <class I, class A>
+        constexpr void Constant<F>::terms(I &n, I &d, bool &) const
+        {
+            n = I(value);
+            d = I(1);
+        }
+
+
+        template <class F>
+        constexpr F Constant<F>::eager() const
+        {
+            return F(value);
+        }
+
+
+        template <class E>
+        constexpr Negation<E>::Negation(const E &e)
+            : operand(e)
+        {
+        }
+
+
+        template <class E>
+        template <class I, class A>
+        constexpr void Negation<E>::terms(I &n, I &d, bool &overflow) const
+        {
+            operand.template terms<I, A>(n, d, overflow);
+            n = A::sub(I(0), n, overflow);
+        }
+
+
+        template <class E>
+        constexpr typename Negation<E>::fraction_type Negation<E>::eager() const
+        {
+            return -operand.eager();
+        }
+
+
+        template <Operation op, class L, class R>
+        constexpr Binary<op, L, R>::Binary(const L &l, const R &r)
+            : left(l), right(r)
+        {
+        }
+
+
+        template <Operation op, class L, class R>
+        template <class I, class A>
+        constexpr void Binary<op, L, R>::terms(I &n, I &d, bool &overflow) const
+        {
+            I n1(0), d1(1), n2(0), d2(1);
+            left.template terms<I, A>(n1, d1, overflow);
+            right.template terms<I, A>(n2, d2, overflow);
+
+            if constexpr (op == Operation::Add || op == Operation::Sub)
+            {
+                if (op == Operation::Sub)
+                    n2 = A::sub(I(0), n2, overflow);
+
+                // No reduction on the way: the common denominator is the product
+                if (d1 == d2)
+                {
+                    n = A::add(n1, n2, overflow);
+                    d = d1;
+                } else {
+                    n = A::add(A::mul(n1, d2, overflow), A::mul(n2, d1, overflow), overflow);
+                    d = A::mul(d1, d2, overflow);
+                }
+            }
+            else if constexpr (op == Operation::Mul)
+            {
+                n = A::mul(n1, n2, overflow);
+                d = A::mul(d1, d2, overflow);
+            }
+            else
+            {
+                assertm(n2 != 0, "Error: division by zero");
+
+                // Multiplication by the inverse, whose sign is carried by the numerator
+                if (n2 < 0)
+                {
+                    n2 = A::sub(I(0), n2, overflow);
+                    d2 = A::sub(I(0), d2, overflow);
+                }
+
+                n = A::mul(n1, d2, overflow);
+                d = A::mul(d1, n2, overflow);
+            }
+        }
+
+
+        template <Operation op, class L, class R>
+        constexpr typename Binary<op, L, R>::fraction_type Binary<op, L, R>::eager() const
+        {
+            if constexpr (op == Operation::Add)
+                return left.eager() + right.eager();
+            else if constexpr (op == Operation::Sub)
+                return left.eager() - right.eager();
+            else if constexpr (op == Operation::Mul)
+                return left.eager() * right.eager();
+            else
+                return left.eager() / right.eager();
+        }
+    }
+
+
+    template <class E>
+    constexpr Expression<E>::Expression(const E &root)
+        : node(root)
+    {
+    }
+
+
+    template <class E>
+    constexpr const E &Expression<E>::root() const
+    {
+        return node;
+    }
+
+
+    template <class E>
+    constexpr typename Expression<E>::fraction_type Expression<E>::eval() const
+    {
+        typedef typename detail::Accumulator<typename fraction_type::integer_type>::type I;
+
+        I n(0), d(1);
+        bool overflow = false;
+        node.template terms<I, CheckedArithmetic<>>(n, d, overflow);
+
+        fraction_type result;
+        if (!overflow && detail::narrow(n, d, result))
+            return result;
+
+        // Out of range: the operators of Fraction apply the policy
+        return node.eager();
+    }
+
+
+    template <class E>
+    constexpr Expression<E>::operator fraction_type() const
+    {
+        return this->eval();
+    }
+
+
+    template <class T1, class T2, class Policy>
+    constexpr Expression<detail::Leaf<Fraction<T1, T2, Policy>>> expr(const Fraction<T1, T2, Policy> &frac)
+    {
+        return Expression<detail::Leaf<Fraction<T1, T2, Policy>>>(detail::Leaf<Fraction<T1, T2, Policy>>(frac));
+    }
+
+
+    template <class L, class R, typename std::enable_if<detail::ExpressionResult<L, R>::valid, int>::type>
+    constexpr auto operator+(const L &l, const R &r)
+    {
+        return detail::ExpressionResult<L, R>::template make<detail::Operation::Add>(l, r);
+    }
+
+
+    template <class L, class R, typename std::enable_if<detail::ExpressionResult<L, R>::valid, int>::type>
+    constexpr auto operator-(const L &l, const R &r)
+    {
+        return detail::ExpressionResult<L, R>::template make<detail::Operation::Sub>(l, r);
+    }
+
+
+    template <class L, class R, typename std::enable_if<detail::ExpressionResult<L, R>::valid, int>::type>
+    constexpr auto operator*(const L &l, const R &r)
+    {
+        return detail::ExpressionResult<L, R>::template make<detail::Operation::Mul>(l, r);
+    }
+
+
+    template <class L, class R, typename std::enable_if<detail::ExpressionResult<L, R>::valid, int>::type>
+    constexpr auto operator/(const L &l, const R &r)
+    {
+        return detail::ExpressionResult<L, R>::template make<detail::Operation::Div>(l, r);
+    }
+
+
+    template <class E>
+    constexpr Expression<detail::Negation<E>> operator-(const Expression<E> &e)
+    {
+        return Expression<detail::Negation<E>>(detail::Negation<E>(e.root()));
+    }
+}
+
+
+#endif  /*_EXPRESSION_H_*/
@@ -0,0 +1,755 @@
+#ifndef _FAREY_H_
+#define _FAREY_H_
+
+/**
+ * \file farey.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Streaming Farey sequences and Stern-Brocot enumerations
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "fraction.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /**
+     * \class FareyRange
+     * \brief Range over the Farey sequence of order n between two of its terms
+     *
+     * Each term follows from the two previous ones, (a/b, c/d) giving
+     * (kc - a) / (kd - b) with k = (n + b) / d: the fractions come out
+     * irreducible without any GCD. The ranges given by split() cover the
+     * sequence with no overlap and can be walked by different threads.
+     */
+    template <class T1, class T2 = double>
+    class FareyRange
+    {
+    public:
+        typedef Fraction<T1, T2> value_type;    /*!< Type of the terms */
+
+    private:
+        T1 order;               /*!< Largest denominator */
+        T1 firstNum, firstDenom;    /*!< First term */
+        T1 lastNum, lastDenom;      /*!< Last term */
+
+    public:
+        /**
+         * \class const_iterator
+         * \brief Forward iterator computing the terms on increment
+         */
+        class const_iterator
+        {
+        private:
+            T1 order;       /*!< Largest denominator */
+            T1 a, b;        /*!< Current term */
+            T1 c, d;        /*!< Next term of the whole sequence */
+            T1 lastNum;     /*!< Numerator of the last term */
+            T1 lastDenom;   /*!< Denominator of the last term, 0 past the end */
+
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef Fraction<T1, T2> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const value_type *pointer;
+            typedef value_type reference;
+
+            /**
+             * \brief Constructor
+             * \param[in] range The range, whose first term is the current one
+             * \param[in] end Whether the iterator is the end
+             */
+            const_iterator(const FareyRange &range, bool end);
+
+            value_type operator*() const;
+            const_iterator &operator++();
+            const_iterator operator++(int);
+            bool operator==(const const_iterator &it) const;
+            bool operator!=(const const_iterator &it) const;
+        };
+
+        /**
+         * \brief Constructor, the whole sequence from 0 to 1
+         * \param[in] n The order, positive
+         */
+        explicit FareyRange(T1 n);
+
+        /**
+         * \brief Constructor, the terms from first to last
+         * \param[in] n The order, positive
+         * \param[in] first First term, in [0, 1] with a denominator up to n
+         * \param[in] last Last term, in [first, 1] with a denominator up to n
+         */
+        FareyRange(T1 n, const Fraction<T1, T2> &first, const Fraction<T1, T2> &last);
+
+        /**
+         * \brief Order getter
+         * \return The largest denominator
+         */
+        T1 getOrder() const;
+
+        /**
+         * \brief Number of terms, see fareyRank()
+         * \return The size of the range, counted in O(n log n) without enumeration
+         */
+        T1 size() const;
+
+        /**
+         * \brief Partition of the range
+         * \param[in] parts Number of parts
+         * \return Consecutive ranges of sizes differing by at most 1, fewer if the range is smaller
+         */
+        std::vector<FareyRange> split(std::size_t parts) const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+    };
+
+
+    /**
+     * \class SternBrocotRange
+     * \brief In-order range over the Stern-Brocot tree cut at a depth
+     *
+     * The terms are the positive rationals whose partial quotients sum to
+     * at most depth, in increasing order. Each node is the mediant of its
+     * bounds, so no GCD is needed; a stack of ancestors gives O(1)
+     * amortized steps.
+     */
+    template <class T1, class T2 = double>
+    class SternBrocotRange
+    {
+    public:
+        typedef Fraction<T1, T2> value_type;    /*!< Type of the terms */
+
+    private:
+        unsigned depth;     /*!< Number of levels */
+
+    public:
+        /**
+         * \class const_iterator
+         * \brief Forward iterator walking the tree
+         */
+        class const_iterator
+        {
+        private:
+            /**
+             * \brief Node given by its left and right bounds
+             */
+            struct Node
+            {
+                T1 a, b, c, d;      /*!< Bounds a/b and c/d, the node being (a+c)/(b+d) */
+                unsigned level;     /*!< Depth of the node, 1 for the root */
+            };
+
+            std::vector<Node> path;     /*!< Ancestors left to visit, the current node last */
+            unsigned depth;             /*!< Number of levels */
+
+            /**
+             * \brief Push of the leftmost descendants of a node, the node included
+             */
+            void descend(Node node);
+
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef Fraction<T1, T2> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const value_type *pointer;
+            typedef value_type reference;
+
+            /**
+             * \brief Constructor
+             * \param[in] levels Number of levels
+             * \param[in] end Whether the iterator is the end
+             */
+            const_iterator(unsigned levels, bool end);
+
+            value_type operator*() const;
+            const_iterator &operator++();
+            const_iterator operator++(int);
+            bool operator==(const const_iterator &it) const;
+            bool operator!=(const const_iterator &it) const;
+        };
+
+        /**
+         * \brief Constructor
+         * \param[in] levels Number of levels, 2^levels - 1 terms
+         */
+        explicit SternBrocotRange(unsigned levels);
+
+        const_iterator begin() const;
+        const_iterator end() const;
+    };
+
+
+    /**
+     * \class CalkinWilfRange
+     * \brief Range over the first positive rationals in breadth-first order of the Calkin-Wilf tree
+     *
+     * Every positive rational comes exactly once, each level holding the
+     * same fractions as the level of the Stern-Brocot tree. The terms follow
+     * Newman's recurrence x' = 1 / (2 floor(x) + 1 - x), one division each.
+     */
+    template <class T1, class T2 = double>
+    class CalkinWilfRange
+    {
+    public:
+        typedef Fraction<T1, T2> value_type;    /*!< Type of the terms */
+
+    private:
+        std::size_t count;      /*!< Number of terms */
+
+    public:
+        /**
+         * \class const_iterator
+         * \brief Forward iterator computing the terms on increment
+         */
+        class const_iterator
+        {
+        private:
+            T1 p, q;                /*!< Current term */
+            std::size_t remaining;  /*!< Terms left, the current one included */
+
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef Fraction<T1, T2> value_type;
+            typedef std::ptrdiff_t difference_type;
+            typedef const value_type *pointer;
+            typedef value_type reference;
+
+            /**
+             * \brief Constructor, from 1/1
+             * \param[in] count Number of terms left
+             */
+            explicit const_iterator(std::size_t count);
+
+            value_type operator*() const;
+            const_iterator &operator++();
+            const_iterator operator++(int);
+            bool operator==(const const_iterator &it) const;
+            bool operator!=(const const_iterator &it) const;
+        };
+
+        /**
+         * \brief Constructor
+         * \param[in] terms Number of terms
+         */
+        explicit CalkinWilfRange(std::size_t terms);
+
+        const_iterator begin() const;
+        const_iterator end() const;
+    };
+
+
+    /**
+     * \brief Farey sequence
+     * \param[in] n The order, positive
+     * \return The range over the irreducible fractions of [0, 1] with denominators up to n
+     */
+    template <class T1, class T2 = double>
+    FareyRange<T1, T2> farey(T1 n);
+
+    /**
+     * \brief Length of the Farey sequence, 1 + phi(1) + ... + phi(n)
+     * \param[in] n The order, positive
+     * \return The number of terms
+     */
+    template <class T1>
+    T1 fareyCount(T1 n);
+
+    /**
+     * \brief Rank of a number in the Farey sequence
+     * \param[in] n The order, positive
+     * \param[in] x A fraction of [0, 1], whose terms times n fit in T1
+     * \return The number of terms less than or equal to x
+     *
+     * Counts floor(xq) + 1 for every denominator q, then removes the
+     * reducible fractions by a sieve: O(n log n) time, O(n) memory.
+     */
+    template <class T1, class T2, class Policy>
+    T1 fareyRank(T1 n, const Fraction<T1, T2, Policy> &x);
+
+    /**
+     * \brief Term of the Farey sequence at a given position
+     * \param[in] n The order, positive
+     * \param[in] k The position, from 0 up to fareyCount(n) - 1
+     * \return The k-th term
+     *
+     * Binary search of the interval (i/n, (i+1)/n] holding the term, in
+     * which each denominator has at most one fraction: O(n log^2 n).
+     */
+    template <class T1, class T2 = double>
+    Fraction<T1, T2> fareySelect(T1 n, T1 k);
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    namespace detail
+    {
+        /**
+         * \brief Number of fractions p/q <= num/denom with 0 <= p and q <= n, irreducible
+         */
+        template <class T1>
+        T1 fareyRank(T1 n, T1 num, T1 denom)
+        {
+            std::vector<T1> counts(std::size_t(n) + 1);
+            for (T1 q = 1; q <= n; q++)
+                counts[std::size_t(q)] = num * q / denom + 1;
+
+            // Fractions of denominator q reduce to those of its divisors
+            T1 total(0);
+            for (T1 q = 1; q <= n; q++)
+            {
+                const T1 own = counts[std::size_t(q)];
+                total += own;
+                for (T1 m = 2 * q; m <= n; m += q)
+                    counts[std::size_t(m)] -= own;
+            }
+
+            return total;
+        }
+
+
+        /**
+         * \brief Successor of num/denom in the Farey sequence of order n
+         *
+         * The successor c/d is the one with bc - ad = 1 and the largest d,
+         * found from the inverse of num modulo denom.
+         */
+        template <class T1>
+        void fareyNext(T1 n, T1 num, T1 denom, T1 &c, T1 &d)
+        {
+            // Extended Euclid: u * num = 1 mod denom
+            T1 r0 = denom, r1 = num % denom, u0(0), u1(1);
+            while (r1 != 0)
+            {
+                const T1 q = r0 / r1, r2 = r0 - q * r1, u2 = u0 - q * u1;
+                r0 = r1;
+                r1 = r2;
+                u0 = u1;
+                u1 = u2;
+            }
+
+            // d = -u mod denom, then raised as high as possible
+            d = denom == 1 ? T1(0) : ((-u0) % denom + denom) % denom;
+            d += (n - d) / denom * denom;
+            c = (1 + num * d) / denom;
+        }
+    }
+
+
+    template <class T1, class T2>
+    FareyRange<T1, T2>::FareyRange(T1 n)
+        : order(n), firstNum(0), firstDenom(1), lastNum(1), lastDenom(1)
+    {
+        assertm(n > 0, "Order should be positive");
+    }
+
+
+    template <class T1, class T2>
+    FareyRange<T1, T2>::FareyRange(T1 n, const Fraction<T1, T2> &first, const Fraction<T1, T2> &last)
+        : order(n), firstNum(first.getNum()), firstDenom(first.getDenom()), lastNum(last.getNum()), lastDenom(last.getDenom())
+    {
+        assertm(n > 0, "Order should be positive");
+        assertm(firstDenom <= n && lastDenom <= n, "Terms should be in the Farey sequence");
+        assertm(firstNum >= 0 && firstNum * lastDenom <= lastNum * firstDenom && lastNum <= lastDenom, "Terms should be ordered in [0, 1]");
+    }
+
+
+    template <class T1, class T2>
+    T1 FareyRange<T1, T2>::getOrder() const
+    {
+        return order;
+    }
+
+
+    template <class T1, class T2>
+    T1 FareyRange<T1, T2>::size() const
+    {
+        if (firstNum == 0 && lastNum == lastDenom)
+            return fareyCount(order);
+
+        return detail::fareyRank(order, lastNum, lastDenom) - detail::fareyRank(order, firstNum, firstDenom) + 1;
+    }
+
+
+    template <class T1, class T2>
+    std::vector<FareyRange<T1, T2>> FareyRange<T1, T2>::split(std::size_t parts) const
+    {
+        const T1 before = detail::fareyRank(order, firstNum, firstDenom) - 1;
+        const T1 total = detail::fareyRank(order, lastNum, lastDenom) - before;
+        if (T1(parts) > total)
+            parts = std::size_t(total);
+
+        std::vector<FareyRange> ranges;
+        ranges.reserve(parts);
+
+        Fraction<T1, T2> first(firstNum, firstDenom, irreducible);
+        for (std::size_t i = 1; i <= parts; i++)
+        {
+            // Part i - 1 ends right before the term of index total * i / parts
+            const T1 end = total * T1(i) / T1(parts);
+            const Fraction<T1, T2> last = i == parts ? Fraction<T1, T2>(lastNum, lastDenom, irreducible)
+                                                     : fareySelect<T1, T2>(order, before + end - 1);
+            ranges.push_back(FareyRange(order, first, last));
+
+            if (i < parts)
+            {
+                T1 c, d;
+                detail::fareyNext(order, last.getNum(), last.getDenom(), c, d);
+                first = Fraction<T1, T2>(c, d, irreducible);
+            }
+        }
+
+        return ranges;
+    }
+
+
+    template <class T1, class T2>
+    typename FareyRange<T1, T2>::const_iterator FareyRange<T1, T2>::begin() const
+    {
+        return const_iterator(*this, false);
+    }
+
+
+    template <class T1, class T2>
+    typename FareyRange<T1, T2>::const_iterator FareyRange<T1, T2>::end() const
+    {
+        return const_iterator(*this, true);
+    }
+
+
+    template <class T1, class T2>
+    FareyRange<T1, T2>::const_iterator::const_iterator(const FareyRange &range, bool end)
+        : order(range.order), a(range.firstNum), b(range.firstDenom), c(0), d(0),
+          lastNum(range.lastNum), lastDenom(end ? T1(0) : range.lastDenom)
+    {
+        if (!end && !(a == b))
+            detail::fareyNext(order, a, b, c, d);
+    }
+
+
+    template <class T1, class T2>
+    typename FareyRange<T1, T2>::const_iterator::value_type FareyRange<T1, T2>::const_iterator::operator*() const
+    {
+        // Consecutive Farey terms are irreducible
+        return value_type(a, b, irreducible);
+    }
+
+
+    template <class T1, class T2>
+    typename FareyRange<T1, T2>::const_iterator &FareyRange<T1, T2>::const_iterator::operator++()
+    {
+        if (a == lastNum && b == lastDenom)
+        {
+            lastDenom = 0;
+            return *this;
+        }
+
+        const T1 k = (order + b) / d;
+        const T1 e = k * c - a, f = k * d - b;
+        a = c;
+        b = d;
+        c = e;
+        d = f;
+
+        return *this;
+    }
+
+
+    template <class T1, class T2>
+    typename FareyRange<T1, T2>::const_iterator FareyRange<T1, T2>::const_iterator::operator++(int)
+    {
+        const_iterator it = *this;
+        ++*this;
+        return it;
+    }
+
+
+    template <class T1, class T2>
+    bool FareyRange<T1, T2>::const_iterator::operator==(const const_iterator &it) const
+    {
+        if (lastDenom == 0 || it.lastDenom == 0)
+            return lastDenom == it.lastDenom;
+
+        return a == it.a && b == it.b;
+    }
+
+
+    template <class T1, class T2>
+    bool FareyRange<T1, T2>::const_iterator::operator!=(const const_iterator &it) const
+    {
+        return !(*this == it);
+    }
+
+
+    template <class T1, class T2>
+    SternBrocotRange<T1, T2>::SternBrocotRange(unsigned levels)
+        : depth(levels)
+    {
+    }
+
+
+    template <class T1, class T2>
+    typename SternBrocotRange<T1, T2>::const_iterator SternBrocotRange<T1, T2>::begin() const
+    {
+        return const_iterator(depth, false);
+    }
+
+
+    template <class T1, class T2>
+    typename SternBrocotRange<T1, T2>::const_iterator SternBrocotRange<T1, T2>::end() const
+    {
+        return const_iterator(depth, true);
+    }
+
+
+    template <class T1, class T2>
+    SternBrocotRange<T1, T2>::const_iterator::const_iterator(unsigned levels, bool end)
+        : depth(levels)
+    {
+        if (!end && levels > 0)
+        {
+            path.reserve(levels);
+            this->descend(Node{T1(0), T1(1), T1(1), T1(0), 1});
+        }
+    }
+
+
+    template <class T1, class T2>
+    void SternBrocotRange<T1, T2>::const_iterator::descend(Node node)
+    {
+        path.push_back(node);
+        while (node.level < depth)
+        {
+            // Left child: bounds a/b and the node
+            node = Node{node.a, node.b, node.a + node.c, node.b + node.d, node.level + 1};
+            path.push_back(node);
+        }
+    }
+
+
+    template <class T1, class T2>
+    typename SternBrocotRange<T1, T2>::const_iterator::value_type SternBrocotRange<T1, T2>::const_iterator::operator*() const
+    {
+        // Mediants of Stern-Brocot neighbours are irreducible
+        const Node &node = path.back();
+        return value_type(node.a + node.c, node.b + node.d, irreducible);
+    }
+
+
+    template <class T1, class T2>
+    typename SternBrocotRange<T1, T2>::const_iterator &SternBrocotRange<T1, T2>::const_iterator::operator++()
+    {
+        const Node node = path.back();
+        path.pop_back();
+
+        // Right subtree next, then the closest ancestor on the left path
+        if (node.level < depth)
+            this->descend(Node{node.a + node.c, node.b + node.d, node.c, node.d, node.level + 1});
+
+        return *this;
+    }
+
+
+    template <class T1, class T2>
+    typename SternBrocotRange<T1, T2>::const_iterator SternBrocotRange<T1, T2>::const_iterator::operator++(int)
+    {
+        const_iterator it = *this;
+        ++*this;
+        return it;
+    }
+
+
+    template <class T1, class T2>
+    bool SternBrocotRange<T1, T2>::const_iterator::operator==(const const_iterator &it) const
+    {
+        if (path.empty() || it.path.empty())
+            return path.empty() && it.path.empty();
+
+        const Node &x = path.back(), &y = it.path.back();
+        return x.a + x.c == y.a + y.c && x.b + x.d == y.b + y.d;
+    }
+
+
+    template <class T1, class T2>
+    bool SternBrocotRange<T1, T2>::const_iterator::operator!=(const const_iterator &it) const
+    {
+        return !(*this == it);
+    }
+
+
+    template <class T1, class T2>
+    CalkinWilfRange<T1, T2>::CalkinWilfRange(std::size_t terms)
+        : count(terms)
+    {
+    }
+
+
+    template <class T1, class T2>
+    typename CalkinWilfRange<T1, T2>::const_iterator CalkinWilfRange<T1, T2>::begin() const
+    {
+        return const_iterator(count);
+    }
+
+
+    template <class T1, class T2>
+    typename CalkinWilfRange<T1, T2>::const_iterator CalkinWilfRange<T1, T2>::end() const
+    {
+        return const_iterator(0);
+    }
+
+
+    template <class T1, class T2>
+    CalkinWilfRange<T1, T2>::const_iterator::const_iterator(std::size_t count)
+        : p(1), q(1), remaining(count)
+    {
+    }
+
+
+    template <class T1, class T2>
+    typename CalkinWilfRange<T1, T2>::const_iterator::value_type CalkinWilfRange<T1, T2>::const_iterator::operator*() const
+    {
+        // Each term is irreducible as the one before
+        return value_type(p, q, irreducible);
+    }
+
+
+    template <class T1, class T2>
+    typename CalkinWilfRange<T1, T2>::const_iterator &CalkinWilfRange<T1, T2>::const_iterator::operator++()
+    {
+        // p/q -> q / (2 floor(p/q) q + q - p)
+        const T1 next = (2 * (p / q) + 1) * q - p;
+        p = q;
+        q = next;
+        remaining--;
+
+        return *this;
+    }
+
+
+    template <class T1, class T2>
+    typename CalkinWilfRange<T1, T2>::const_iterator CalkinWilfRange<T1, T2>::const_iterator::operator++(int)
+    {
+        const_iterator it = *this;
+        ++*this;
+        return it;
+    }
+
+
+    template <class T1, class T2>
+    bool CalkinWilfRange<T1, T2>::const_iterator::operator==(const const_iterator &it) const
+    {
+        return remaining == it.remaining;
+    }
+
+
+    template <class T1, class T2>
+    bool CalkinWilfRange<T1, T2>::const_iterator::operator!=(const const_iterator &it) const
+    {
+        return !(*this == it);
+    }
+
+
+    template <class T1, class T2>
+    FareyRange<T1, T2> farey(T1 n)
+    {
+        return FareyRange<T1, T2>(n);
+    }
+
+
+    template <class T1>
+    T1 fareyCount(T1 n)
+    {
+        assertm(n > 0, "Order should be positive");
+
+        // Sieve of Euler's totient
+        std::vector<T1> phi(std::size_t(n) + 1);
+        for (T1 i = 0; i <= n; i++)
+            phi[std::size_t(i)] = i;
+
+        T1 total(1);
+        for (T1 i = 1; i <= n; i++)
+        {
+            if (i > 1 && phi[std::size_t(i)] == i)
+                for (T1 m = i; m <= n; m += i)
+                    phi[std::size_t(m)] -= phi[std::size_t(m)] / i;
+            total += phi[std::size_t(i)];
+        }
+
+        return total;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    T1 fareyRank(T1 n, const Fraction<T1, T2, Policy> &x)
+    {
+        assertm(n > 0, "Order should be positive");
+        assertm(x.getNum() >= 0 && x.getNum() <= x.getDenom(), "Number should be in [0, 1]");
+
+        return detail::fareyRank(n, x.getNum(), x.getDenom());
+    }
+
+
+    template <class T1, class T2>
+    Fraction<T1, T2> fareySelect(T1 n, T1 k)
+    {
+        assertm(n > 0, "Order should be positive");
+        assertm(k >= 0, "Position should not be negative");
+
+        if (k == 0)
+            return Fraction<T1, T2>(T1(0), T1(1), irreducible);
+
+        // Largest i with rank(i/n) <= k, the term being in (i/n, (i+1)/n]
+        T1 low(0), high(n);
+        while (low < high)
+        {
+            const T1 middle = low + (high - low + 1) / 2;
+            if (detail::fareyRank(n, middle, n) <= k)
+                low = middle;
+            else
+                high = middle - 1;
+        }
+        assertm(low < n, "Position should be less than the length of the sequence");
+
+        // One candidate per denominator, reducible ones duplicating their reduced form
+        std::vector<std::pair<T1, T1>> candidates;
+        for (T1 q = 1; q <= n; q++)
+        {
+            const T1 p = (low + 1) * q / n;
+            if (p * n > low * q)
+                candidates.emplace_back(p, q);
+        }
+
+        std::sort(candidates.begin(), candidates.end(), [](const std::pair<T1, T1> &u, const std::pair<T1, T1> &v)
+        {
+            const T1 left = u.first * v.second, right = v.first * u.second;
+            return left < right || (left == right && u.second < v.second);
+        });
+        candidates.erase(std::unique(candidates.begin(), candidates.end(), [](const std::pair<T1, T1> &u, const std::pair<T1, T1> &v)
+        {
+            return u.first * v.second == v.first * u.second;
+        }), candidates.end());
+
+        const std::pair<T1, T1> &term = candidates[std::size_t(k - detail::fareyRank(n, low, n))];
+        return Fraction<T1, T2>(term.first, term.second, irreducible);
+    }
+}
+
+
+#endif  /*_FAREY_H_*/
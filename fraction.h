@@ -11,8 +11,19 @@
 
 #include <iostream>
 #include <cmath>
-#include <vector>
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <ratio>
+#include <stdexcept>
+#if __cplusplus > 201703L
+#include <compare>
+#endif
+
+#include "gcd.h"
 
 /**
  * \brief Shortcut for assertion with a message
@@ -20,7 +31,7 @@
  * \param exp Expression to be checked for the assertion
  * \param msg Message to be printed if assertion error
  */
-#define assertm(exp, msg) assert((msg, exp))
+#define assertm(exp, msg) assert((exp) && (msg))
 
 
 /**
@@ -29,12 +40,705 @@
  */
 namespace frac
 {
+    /************
+     * Policies *
+     ************/
+
+    /**
+     * \struct EagerReduction
+     * \brief Reduction after every operation, fractions are always irreducible
+     */
+    struct EagerReduction
+    {
+        static const bool lazy = false;     /*!< Reduction is never deferred */
+    };
+
+
+    /**
+     * \struct LazyReduction
+     * \brief Reduction deferred until the canonical form is needed
+     *
+     * The canonical form is needed by getNum(), getDenom(), == and <<.
+     */
+    struct LazyReduction
+    {
+        static const bool lazy = true;      /*!< Reduction may be deferred */
+
+        /**
+         * \brief Tells whether a deferred reduction has to be done now
+         * \param[in] pending Number of operations since the last reduction
+         * \param[in] num Current numerator
+         * \param[in] denom Current denominator
+         * \return Always false
+         */
+        template <class T1>
+        static constexpr bool due(unsigned int pending, const T1 &num, const T1 &denom)
+        {
+            (void) pending; (void) num; (void) denom;
+            return false;
+        }
+    };
+
+
+    /**
+     * \struct PeriodicReduction
+     * \brief Reduction deferred for at most N operations
+     */
+    template <unsigned int N>
+    struct PeriodicReduction
+    {
+        static const bool lazy = true;      /*!< Reduction may be deferred */
+
+        /**
+         * \brief Tells whether a deferred reduction has to be done now
+         * \param[in] pending Number of operations since the last reduction
+         * \param[in] num Current numerator
+         * \param[in] denom Current denominator
+         * \return True once N operations have been done without reduction
+         */
+        template <class T1>
+        static constexpr bool due(unsigned int pending, const T1 &num, const T1 &denom)
+        {
+            (void) num; (void) denom;
+            return pending >= N;
+        }
+    };
+
+
+    /**
+     * \struct ThresholdReduction
+     * \brief Reduction deferred while numerator and denominator stay below 2^Bits
+     *
+     * Bits must be lower than the number of value bits of T1.
+     */
+    template <unsigned int Bits>
+    struct ThresholdReduction
+    {
+        static const bool lazy = true;      /*!< Reduction may be deferred */
+
+        /**
+         * \brief Tells whether a deferred reduction has to be done now
+         * \param[in] pending Number of operations since the last reduction
+         * \param[in] num Current numerator
+         * \param[in] denom Current denominator
+         * \return True if the magnitude of num or denom reached 2^Bits
+         */
+        template <class T1>
+        static constexpr bool due(unsigned int pending, const T1 &num, const T1 &denom)
+        {
+            (void) pending;
+            const T1 limit = T1(1) << Bits;
+            return num >= limit || num <= -limit || denom >= limit;
+        }
+    };
+
+
+    /**
+     * \struct ThrowOnOverflow
+     * \brief Overflow handler throwing std::overflow_error
+     */
+    struct ThrowOnOverflow
+    {
+        /**
+         * \brief Called when the result of an operation does not fit in T1
+         */
+        static void overflow()
+        {
+            throw std::overflow_error("frac::Fraction: integer overflow");
+        }
+    };
+
+
+    /**
+     * \struct FlagOnOverflow
+     * \brief Overflow handler raising a sticky thread local flag
+     *
+     * The operation goes on with wrapped values, which are meaningless once
+     * the flag is raised.
+     */
+    struct FlagOnOverflow
+    {
+        /**
+         * \brief The flag of the calling thread, to be checked and cleared by the user
+         * \return A reference to the flag
+         */
+        static bool &flag()
+        {
+            thread_local bool raised = false;
+            return raised;
+        }
+
+        /**
+         * \brief Called when the result of an operation does not fit in T1
+         */
+        static void overflow()
+        {
+            flag() = true;
+        }
+    };
+
+
+    /**
+     * \struct UncheckedArithmetic
+     * \brief Plain integer arithmetic, overflows go unnoticed
+     */
+    struct UncheckedArithmetic
+    {
+        static const bool checked = false;      /*!< Overflows are not detected */
+        static const bool widening = false;     /*!< No wider fallback */
+
+        template <class T> static constexpr T add(T a, T b, bool &) { return a + b; }
+        template <class T> static constexpr T sub(T a, T b, bool &) { return a - b; }
+        template <class T> static constexpr T mul(T a, T b, bool &) { return a * b; }
+    };
+
+
+    /**
+     * \struct CheckedArithmetic
+     * \brief Arithmetic detecting every overflow of T1, reported to OnOverflow
+     *
+     * The checks are accumulated in a flag tested once per operation.
+     */
+    template <class OnOverflow = ThrowOnOverflow>
+    struct CheckedArithmetic
+    {
+        static const bool checked = true;       /*!< Overflows are detected */
+        static const bool widening = false;     /*!< No wider fallback */
+        typedef OnOverflow handler;             /*!< Called on overflow */
+
+        template <class T> static constexpr T add(T a, T b, bool &overflow);
+        template <class T> static constexpr T sub(T a, T b, bool &overflow);
+        template <class T> static constexpr T mul(T a, T b, bool &overflow);
+    };
+
+
+    /**
+     * \struct WideningArithmetic
+     * \brief Checked arithmetic redoing overflowed operations in a wider type
+     *
+     * The operation is computed again with intermediates twice as wide as T1
+     * (128-bit for long), reduced, then narrowed back. OnOverflow is only
+     * called if the irreducible result itself does not fit in T1, or if
+     * there is no wider builtin type.
+     */
+    template <class OnOverflow = ThrowOnOverflow>
+    struct WideningArithmetic : CheckedArithmetic<OnOverflow>
+    {
+        static const bool widening = true;      /*!< Fallback to wider intermediates */
+    };
+
+
+    /**
+     * \struct DefaultPolicy
+     * \brief Default behaviour of Fraction, inherit from it to customize a part of it
+     */
+    struct DefaultPolicy
+    {
+        typedef AutoGCD gcd;                    /*!< Engine used by reduce(): EuclidGCD, BinaryGCD, LehmerGCD or AutoGCD */
+        typedef EagerReduction reduction;       /*!< When to reduce: EagerReduction, LazyReduction, PeriodicReduction or ThresholdReduction */
+        typedef UncheckedArithmetic arithmetic; /*!< Overflow handling: UncheckedArithmetic, CheckedArithmetic or WideningArithmetic */
+    };
+
+
+    /**
+     * \struct WithGCD
+     * \brief Policy Base whose GCD engine is replaced by GCD
+     */
+    template <class GCD, class Base = DefaultPolicy>
+    struct WithGCD : Base
+    {
+        typedef GCD gcd;        /*!< Engine used by reduce() */
+    };
+
+
+    /**
+     * \struct WithReduction
+     * \brief Policy Base whose reduction strategy is replaced by Reduction
+     */
+    template <class Reduction, class Base = DefaultPolicy>
+    struct WithReduction : Base
+    {
+        typedef Reduction reduction;    /*!< When to reduce */
+    };
+
+
+    /**
+     * \struct WithArithmetic
+     * \brief Policy Base whose overflow handling is replaced by Arithmetic
+     */
+    template <class Arithmetic, class Base = DefaultPolicy>
+    struct WithArithmetic : Base
+    {
+        typedef Arithmetic arithmetic;  /*!< Overflow handling */
+    };
+
+
+
+    namespace detail
+    {
+        /**
+         * \brief Data members of Fraction
+         *
+         * Lazy policies canonicalize in const accessors, hence their mutable
+         * members. Eager ones keep plain members so that constexpr fractions
+         * can be read in constant expressions.
+         */
+        template <class T1, bool Lazy>
+        struct FractionStorage
+        {
+            mutable T1 numerator = T1(0);       /*!< Numerator of integer type T1 */
+            mutable T1 denominator = T1(1);     /*!< Denominator of integer type T1 */
+            mutable unsigned int pending = 0;   /*!< Operations since the last reduction, 0 if irreducible */
+        };
+
+        template <class T1>
+        struct FractionStorage<T1, false>
+        {
+            T1 numerator = T1(0);               /*!< Numerator of integer type T1 */
+            T1 denominator = T1(1);             /*!< Denominator of integer type T1 */
+        };
+
+
+        /**
+         * \brief Largest integer less than or equal to x, usable in constant expressions
+         * \param[in] x A finite floating number
+         * \return floor(x)
+         */
+        template <class T2>
+        constexpr T2 floorOf(T2 x)
+        {
+            // Beyond 2^62 every floating number of interest is an integer
+            if (!(x < T2(4611686018427387904.0) && x > -T2(4611686018427387904.0)))
+                return x;
+
+            T2 t = T2((long long) x);
+            return t > x ? t - 1 : t;
+        }
+
+
+        /**
+         * \brief Largest value of an integer type, 0 if it is unbounded
+         */
+        template <class T>
+        constexpr T largest()
+        {
+            if constexpr (IsBuiltinInteger<T>::value)
+                return T(-1) < T(0) ? T(typename Unsigned<T>::type(-1) >> 1) : T(-1);
+            else
+                return std::numeric_limits<T>::max();
+        }
+
+
+        /**
+         * \struct ExpansionInteger
+         * \brief Unsigned integer type in which a floating number is expanded for a fraction of T
+         *
+         * The widest builtin unsigned type for builtin integers, T itself
+         * otherwise; maxShift is the largest k such that 2^k fits, 0 if unbounded.
+         */
+        template <class T, class Enable = void>
+        struct ExpansionInteger
+        {
+            typedef T type;
+            static const unsigned int maxShift = 0;
+        };
+
+        template <class T>
+        struct ExpansionInteger<T, typename std::enable_if<IsBuiltinInteger<T>::value>::type>
+        {
+#ifdef __SIZEOF_INT128__
+            typedef unsigned __int128 type;
+#else
+            typedef unsigned long long type;
+#endif
+            static const unsigned int maxShift = 8 * sizeof(type) - 1;
+        };
+
+
+        /**
+         * \brief Exact comparison of two non negative ratios, without products
+         * \param[in] a Numerator of the first ratio
+         * \param[in] b Positive denominator of the first ratio
+         * \param[in] c Numerator of the second ratio
+         * \param[in] d Positive denominator of the second ratio
+         * \return Whether a / b < c / d
+         *
+         * The integer parts are compared, then the inverses of the fractional
+         * parts, as their continued fractions.
+         */
+        template <class U>
+        constexpr bool lessRatio(U a, U b, U c, U d)
+        {
+            for (;;)
+            {
+                U qa = a / b, qc = c / d;
+                if (qa != qc)
+                    return qa < qc;
+
+                a = a - qa * b;
+                c = c - qc * d;
+                if (a == U(0))
+                    return c != U(0);
+                if (c == U(0))
+                    return false;
+
+                // a / b < c / d if and only if d / c < b / a
+                U t = a;
+                a = d;
+                d = t;
+                t = b;
+                b = c;
+                c = t;
+            }
+        }
+
+
+        /**
+         * \brief Builtin integer type twice as wide as T, void if there is none
+         */
+        template <class T>
+        struct Wider
+        {
+#ifdef __SIZEOF_INT128__
+            typedef typename std::conditional<!IsBuiltinInteger<T>::value || (sizeof(T) > 8), void,
+                    typename std::conditional<(sizeof(T) > 4), __int128, long long>::type>::type type;
+#else
+            typedef typename std::conditional<!IsBuiltinInteger<T>::value || (sizeof(T) > 4), void, long long>::type type;
+#endif
+        };
+
+
+        /**
+         * \brief 64-bit image of an integer, for hashing
+         * \param[in] value The integer
+         * \return The value itself for builtin integers up to 64 bits
+         */
+        template <class T>
+        constexpr std::uint64_t hashOf(const T &value)
+        {
+            if constexpr (IsBuiltinInteger<T>::value && sizeof(T) > 8)
+                return std::uint64_t(value) ^ std::uint64_t(typename Unsigned<T>::type(value) >> 64) * 0x9E3779B97F4A7C15ull;
+            else if constexpr (IsBuiltinInteger<T>::value)
+                return std::uint64_t(value);
+            else
+                return std::uint64_t(std::hash<T>()(value));
+        }
+
+
+        /**
+         * \brief Hash of a pair of 64-bit values
+         * \param[in] a First value
+         * \param[in] b Second value
+         * \return The finalizer of MurmurHash3 applied to a combination of a and b
+         */
+        constexpr std::uint64_t mixHash(std::uint64_t a, std::uint64_t b)
+        {
+            std::uint64_t x = a * 0x9E3779B97F4A7C15ull + b;
+            x ^= x >> 33;
+            x *= 0xFF51AFD7ED558CCDull;
+            x ^= x >> 33;
+            x *= 0xC4CEB9FE1A85EC53ull;
+            x ^= x >> 33;
+            return x;
+        }
+
+
+        /**
+         * \brief Comparison of a/b and c/d by their continued fraction expansions
+         * \return -1, 0 or 1 as a/b is less than, equal to or greater than c/d
+         *
+         * Only divisions of the operands: nothing can overflow.
+         */
+        template <class U>
+        constexpr int compareExpansions(U a, U b, U c, U d)
+        {
+            int orientation = 1;
+
+            for (;;)
+            {
+                U q1 = a / b, q2 = c / d;
+                if (q1 != q2)
+                    return q1 < q2 ? -orientation : orientation;
+
+                U r1 = a - q1 * b, r2 = c - q2 * d;
+                if (r1 == 0 || r2 == 0)
+                    return r1 == r2 ? 0 : (r1 == 0 ? -orientation : orientation);
+
+                // r1/b compared to r2/d is the opposite of b/r1 compared to d/r2
+                a = b;
+                b = r1;
+                c = d;
+                d = r2;
+                orientation = -orientation;
+            }
+        }
+
+
+        /**
+         * \brief Number of bits of a non zero magnitude
+         */
+        template <class U>
+        constexpr int bitLengthOf(const U &x)
+        {
+            if constexpr (IsBuiltinInteger<U>::value)
+                return int(8 * sizeof(U)) - clz(x);
+            else
+                return int(x.bitLength());
+        }
+
+
+        /**
+         * \brief Product of a floating number by 2^exponent
+         *
+         * Normal powers of two are built from their bits, faster than std::ldexp.
+         */
+        template <class T2>
+        T2 scaleByPowerOfTwo(T2 x, int exponent)
+        {
+            if constexpr (std::is_same<T2, double>::value || std::is_same<T2, float>::value)
+            {
+                typedef typename std::conditional<std::is_same<T2, double>::value, std::uint64_t, std::uint32_t>::type Bits;
+                constexpr int digits = std::numeric_limits<T2>::digits, bias = std::numeric_limits<T2>::max_exponent - 1;
+                if (exponent >= 1 - bias && exponent <= bias)
+                {
+                    const Bits bits = Bits(exponent + bias) << (digits - 1);
+                    T2 power = 0;
+                    std::memcpy(&power, &bits, sizeof(T2));
+                    return x * power;
+                }
+            }
+
+            return std::ldexp(x, exponent);
+        }
+
+
+        /**
+         * \brief Rounding of a scaled 128-bit significand to a floating type
+         * \param[in] negative Sign of the value
+         * \param[in] high Upper 64 bits of the significand, whose top bit is set
+         * \param[in] low Lower 64 bits of the significand
+         * \param[in] sticky True if the value lies strictly above the significand
+         * \param[in] exponent The value is (high 2^64 + low) 2^exponent, plus the sticky part
+         * \return The value rounded to nearest, ties to even, subnormals included
+         */
+        template <class T2>
+        T2 roundSignificand(bool negative, std::uint64_t high, std::uint64_t low, bool sticky, int exponent)
+        {
+            constexpr int digits = std::numeric_limits<T2>::digits;
+            constexpr int normal = std::numeric_limits<T2>::min_exponent - 1;
+
+            // Below the smallest normal, the spacing of the subnormals costs precision
+            const int top = exponent + 127;
+            const int precision = top >= normal ? digits : digits - (normal - top);
+            if (precision < 0)
+                return negative ? -T2(0) : T2(0);
+
+            const int drop = 64 - precision;
+            std::uint64_t kept = 0;
+            bool half = false, rest = sticky;
+            if (drop == 0)
+            {
+                kept = high;
+                half = (low >> 63) != 0;
+                rest = rest || (low << 1) != 0;
+            } else if (drop == 64) {
+                half = (high >> 63) != 0;
+                rest = rest || low != 0 || (high << 1) != 0;
+            } else {
+                kept = high >> drop;
+                half = ((high >> (drop - 1)) & 1) != 0;
+                rest = rest || low != 0 || (high & ((std::uint64_t(1) << (drop - 1)) - 1)) != 0;
+            }
+
+            T2 value = T2(kept);
+            if (half && (rest || (kept & 1) != 0))
+                value = kept + 1 == 0 ? T2(18446744073709551616.0L) : T2(kept + 1);
+
+            // kept fits in the significand, so the scaling is exact or overflows to infinity
+            value = scaleByPowerOfTwo(value, exponent + 64 + drop);
+            return negative ? -value : value;
+        }
+
+
+#ifdef __SIZEOF_INT128__
+        /**
+         * \brief Division of a 128-bit integer whose quotient fits in 64 bits
+         * \param[in] n The dividend, below b 2^64
+         * \param[in] b The non zero divisor
+         * \param[out] r The remainder
+         * \return The quotient
+         */
+        inline std::uint64_t divideWide(unsigned __int128 n, std::uint64_t b, std::uint64_t &r)
+        {
+#if defined(__x86_64__) && defined(__GNUC__)
+            // A single divq, where the compiler would call the full 128-bit division
+            std::uint64_t q = 0;
+            __asm__("divq %[b]" : "=a"(q), "=d"(r) : [b] "rm"(b), "a"(std::uint64_t(n)), "d"(std::uint64_t(n >> 64)));
+            return q;
+#else
+            r = std::uint64_t(n % b);
+            return std::uint64_t(n / b);
+#endif
+        }
+#endif
+
+
+        /**
+         * \brief Correctly rounded quotient of two integers
+         * \param[in] num The numerator
+         * \param[in] denom The non zero denominator
+         * \return num / denom rounded to nearest, ties to even
+         *
+         * Operands exactly representable in T2 are divided in floating point,
+         * which IEEE 754 rounds correctly. Wider ones are shifted so that an
+         * integer division gives at least two bits more than the significand,
+         * the remainder telling whether the value lies above the quotient.
+         */
+        template <class T2, class T1>
+        constexpr T2 quotient(const T1 &num, const T1 &denom)
+        {
+            constexpr int digits = std::numeric_limits<T2>::digits;
+
+            // Types the engine does not know are left to the floating division
+            if constexpr (!std::numeric_limits<T2>::is_iec559 || digits > 64)
+                return (T2) num / (T2) denom;
+            else if constexpr (IsBuiltinInteger<T1>::value && 8 * sizeof(T1) - std::is_signed<T1>::value <= digits)
+                return (T2) num / (T2) denom;
+            else {
+                const bool negative = (num < T1(0)) != (denom < T1(0));
+
+                if constexpr (IsBuiltinInteger<T1>::value)
+                {
+                    typedef typename Unsigned<T1>::type U;
+                    const U a = magnitude(num), b = magnitude(denom);
+                    if (a == 0)
+                        return (T2) num / (T2) denom;
+                    if (a <= (U(1) << digits) && b <= (U(1) << digits))
+                        return (T2) num / (T2) denom;
+
+#ifdef __SIZEOF_INT128__
+                    typedef unsigned __int128 Wide;
+                    if constexpr (sizeof(U) <= 8 && digits <= 62)
+                    {
+                        // a 2^k / b lies in [2^62, 2^64): a single narrowing division
+                        const int la = bitLengthOf(a), lb = bitLengthOf(b), k = 63 + lb - la;
+                        std::uint64_t r = 0;
+                        const std::uint64_t q = divideWide(Wide(a) << k, std::uint64_t(b), r);
+
+                        const int norm = clz(q);
+                        return roundSignificand<T2>(negative, q << norm, 0, r != 0, -k - 64 - norm);
+                    } else if constexpr (sizeof(U) <= 8) {
+                        // a 2^(128 - la) / b has 64 to 128 bits
+                        const int la = bitLengthOf(a);
+                        const Wide scaled = Wide(a) << (128 - la);
+                        const Wide q = scaled / b;
+                        Wide r = scaled % b;
+
+                        // The rounding bit of a 64-bit significand may need the next quotient bits
+                        const int s = bitLengthOf(q) - 64;
+                        std::uint64_t low = std::uint64_t(q << (64 - s));
+                        if (s == 0)
+                        {
+                            low = std::uint64_t((r << 64) / b);
+                            r = (r << 64) % b;
+                        }
+
+                        return roundSignificand<T2>(negative, std::uint64_t(q >> s), low, r != 0, s - 64 + la - 128);
+                    } else {
+                        // 128-bit operands: restoring division, one quotient bit at a time
+                        const int la = bitLengthOf(a);
+                        Wide r = 0, q = 0;
+                        int count = 0, steps = 0;
+                        while (count < 128)
+                        {
+                            const bool carry = (r >> 127) != 0;
+                            r = (r << 1) | (steps < la ? (a >> (la - 1 - steps)) & 1 : 0);
+                            steps++;
+
+                            const bool bit = carry || r >= b;
+                            if (bit)
+                                r -= b;
+                            if (bit || count > 0)
+                            {
+                                q = (q << 1) | Wide(bit);
+                                count++;
+                            }
+                        }
+
+                        return roundSignificand<T2>(negative, std::uint64_t(q >> 64), std::uint64_t(q), r != 0, la - steps);
+                    }
+#else
+                    return (T2) num / (T2) denom;
+#endif
+                } else {
+                    const T1 a = num < T1(0) ? -num : num, b = denom < T1(0) ? -denom : denom;
+                    if (a == T1(0))
+                        return (T2) num / (T2) denom;
+
+                    const int la = bitLengthOf(a), lb = bitLengthOf(b);
+                    if (la <= digits && lb <= digits)
+                        return (T2) num / (T2) denom;
+
+                    // a 2^shift / b has 128 or 129 bits
+                    int shift = 128 - (la - lb);
+                    T1 scaled = shift >= 0 ? a << shift : a >> -shift;
+                    bool sticky = shift < 0 && (scaled << -shift) != a;
+
+                    T1 q = scaled / b;
+                    sticky = sticky || q * b != scaled;
+                    if (bitLengthOf(q) > 128)
+                    {
+                        T1 half = q >> 1;
+                        sticky = sticky || (half << 1) != q;
+                        q = half;
+                        shift--;
+                    }
+
+                    // Words of q, 32 bits at a time through exact floating conversions
+                    std::uint64_t words[4] = {0, 0, 0, 0};
+                    for (int k = 0; k < 4; k++)
+                    {
+                        T1 rest = q >> 32;
+                        words[k] = std::uint64_t(static_cast<double>(q - (rest << 32)));
+                        q = rest;
+                    }
+
+                    return roundSignificand<T2>(negative, words[3] << 32 | words[2], words[1] << 32 | words[0], sticky, -shift);
+                }
+            }
+        }
+
+
+        /**
+         * \brief Compound operations of Fraction, see Fraction::apply()
+         */
+        enum class Operation
+        {
+            Add, Sub, Mul, Div,                     /*!< With a fraction */
+            AddInt, SubInt, MulInt, DivInt          /*!< With an integer */
+        };
+    }
+
+
+
+    /**
+     * \struct Irreducible
+     * \brief Tag for constructors whose arguments are known to be irreducible
+     */
+    struct Irreducible
+    {
+    };
+
+    constexpr Irreducible irreducible{};    /*!< Value of the Irreducible tag */
+
+
+
     /******************
      * Instantiations *
      ******************/
-    template <class T1, class T2> class Fraction;
-    template <class T1, class T2> std::ostream &operator<<(std::ostream&, const Fraction<T1, T2>&);
-    template <class T1, class T2> std::istream &operator>>(std::istream&, Fraction<T1, T2>&);
+    template <class T1, class T2, class Policy = DefaultPolicy> class Fraction;
+    template <class T1, class T2, class Policy> std::ostream &operator<<(std::ostream&, const Fraction<T1, T2, Policy>&);
+    template <class T1, class T2, class Policy> std::istream &operator>>(std::istream&, Fraction<T1, T2, Policy>&);
 
 
 
@@ -45,9 +749,12 @@ namespace frac
     /**
      * \class Fraction
      * \brief Template class for rational numbers
+     *
+     * The behaviour of the class (GCD engine, reduction strategy, ...) is
+     * selected by Policy, see DefaultPolicy.
      */
-    template <class T1, class T2>
-    class Fraction
+    template <class T1, class T2, class Policy>
+    class Fraction : private detail::FractionStorage<T1, Policy::reduction::lazy>
     {
         // Stream operators overloading
         
@@ -57,7 +764,7 @@ namespace frac
          * \param[in] frac The fraction to be displayed
          * \return A reference to the modified stream 
          */
-        friend std::ostream &operator<< <T1, T2>(std::ostream &o, const Fraction<T1, T2> &frac);
+        friend std::ostream &operator<< <T1, T2, Policy>(std::ostream &o, const Fraction<T1, T2, Policy> &frac);
         
         /**
          * \brief Overloading of >> operator
@@ -65,219 +772,358 @@ namespace frac
          * \param[in] frac Reference to the fraction in which to insert data
          * \return A reference to the modified stream
          */
-        friend std::istream &operator>> <T1, T2>(std::istream &i, Fraction<T1, T2> &frac);
+        friend std::istream &operator>> <T1, T2, Policy>(std::istream &i, Fraction<T1, T2, Policy> &frac);
 
     private:
-        T1 numerator;       /*!< Numerator of integer type T1 */
-        T1 denominator;     /*!< Denominator of integer type T1 */
+        typedef detail::FractionStorage<T1, Policy::reduction::lazy> Storage;
+
+        using Storage::numerator;       /*!< Numerator of integer type T1 */
+        using Storage::denominator;     /*!< Denominator of integer type T1 */
+
+        /**
+         * \brief Reduction or bookkeeping after an operation, according to the policy
+         * \param[in] other The other operand of the operation, if any
+         */
+        constexpr void settle(const Fraction<T1, T2, Policy> *other = nullptr);
+
+        /**
+         * \brief Reduction of a deferred fraction, no-op for eager policies
+         */
+        constexpr void canonicalize() const;
+
+        /**
+         * \brief Continued fraction expansion of a floating number, without allocation
+         * \param[in] floating_number The floating number to be converted
+         * \param[in] max_denominator The largest denominator allowed, 0 to stop on the
+         * first convergent evaluating to floating_number
+         * \param[in] tolerance Absolute error at which to stop
+         *
+         * The expansion is exact, on the integer mantissa and power of two of
+         * floating_number, for integer types up to 64 bits.
+         */
+        constexpr void approximateFrom(T2 floating_number, T1 max_denominator, T2 tolerance);
+
+        /**
+         * \brief Compound operation checked and completed according to the policy
+         * \param[in] num Numerator of the other operand (or the integer operand)
+         * \param[in] denom Denominator of the other operand (1 for an integer)
+         * \param[in] other The other operand if it is a fraction
+         */
+        template <detail::Operation op>
+        constexpr void apply(T1 num, T1 denom, const Fraction<T1, T2, Policy> *other = nullptr);
+
+        /**
+         * \brief Compound operation redone in the wider integer type W
+         * \param[in] num Numerator of the other operand
+         * \param[in] denom Denominator of the other operand
+         * \return False if the irreducible result does not fit in T1
+         */
+        template <detail::Operation op, class W>
+        constexpr bool widen(T1 num, T1 denom);
+
+        /**
+         * \brief Kernel of the compound operations, on numerator and denominator of type I
+         * \param[in,out] n Numerator of the fraction
+         * \param[in,out] d Denominator of the fraction
+         * \param[in] num Numerator of the other operand
+         * \param[in] denom Denominator of the other operand
+         * \param[in,out] overflow Raised by the arithmetic A on overflow
+         *
+         * For eager policies the operands are irreducible and Henrici's
+         * algorithms are used: common factors are cancelled before
+         * multiplying, so that the result is irreducible without a full
+         * reduction. Lazy policies do the plain products.
+         */
+        template <detail::Operation op, class A, class I>
+        static constexpr void compute(I &n, I &d, T1 num, T1 denom, bool &overflow);
 
     public:
+        typedef T1 integer_type;        /*!< Type of the numerator and the denominator */
+        typedef T2 floating_type;       /*!< Type of the value given by evaluate() */
+        typedef Policy policy_type;     /*!< Policy of the fraction */
+
         /**
          * \brief Default constructor
          */
-        Fraction();
+        constexpr Fraction();
 
         /**
          * \brief Constructor
          * \param[in] num Integer of type T1
          */
-        Fraction(T1 num);
+        constexpr Fraction(T1 num);
 
         /**
          * \brief Constructor
          * \param[in] num Numerator of integer type T1
          * \param[in] denom Denominator of integer type T1
          */
-        Fraction(T1 num, T1 denom);
+        constexpr Fraction(T1 num, T1 denom);
+
+        /**
+         * \brief Constructor without reduction
+         * \param[in] num Numerator of integer type T1
+         * \param[in] denom Positive denominator of integer type T1, coprime with num
+         *
+         * For data which is already irreducible, such as the output of another
+         * fraction: no GCD is computed.
+         */
+        constexpr Fraction(T1 num, T1 denom, Irreducible);
 
         /**
          * \brief Constructor from number of floating type T2
          * \param[in] floating_number The floating number to be converted
+         *
+         * Gives the first convergent of floating_number which evaluates back to
+         * it (1/10 for 0.1), or the best approximation whose terms fit in T1.
+         * Numbers out of the range of T1 are saturated.
+         */
+        constexpr Fraction(T2 floating_number);
+
+        /**
+         * \brief Constructor from a std::ratio
+         * \param[in] ratio The compile time rational, only its type matters
+         *
+         * The way back is std::ratio<f.getNum(), f.getDenom()> for a constexpr f.
+         */
+        template <std::intmax_t N, std::intmax_t D>
+        constexpr Fraction(std::ratio<N, D> ratio);
+
+        /**
+         * \brief Best rational approximation of a floating number with a bounded denominator
+         * \param[in] floating_number The floating number to be approximated
+         * \param[in] max_denominator The largest denominator allowed, 0 for the conversion of the constructor
+         * \param[in] tolerance Absolute error at which to stop, 0 to go as far as possible
+         * \return The closest fraction to floating_number whose denominator is at most
+         * max_denominator, or the first convergent within tolerance
+         *
+         * The exact continued fraction expansion is stopped on the bound, and the
+         * closest semiconvergent is chosen, as Python's limit_denominator.
          */
-        Fraction(T2 floating_number);
+        static constexpr Fraction<T1, T2, Policy> approximate(T2 floating_number, T1 max_denominator, T2 tolerance = T2(0));
 
         /**
          * \brief Numerator getter
          * \return The numerator of integer type T1
          */
-        T1 getNum() const;
+        constexpr T1 getNum() const;
 
         /**
          * \brief Denominator getter
          * \return The denominator of integer type T1
          */
-        T1 getDenom() const;
+        constexpr T1 getDenom() const;
 
         /**
          * \brief Reduction to an irreductible fraction
          */
-        void reduce();
+        constexpr void reduce();
+
+        /**
+         * \brief Tells whether the fraction may not be irreducible
+         * \return True if a deferred reduction is pending
+         */
+        constexpr bool isPending() const;
 
         /**
          * \brief Evaluation of the fraction's value
          * \return The floating value of type T2
          */
-        T2 evaluate() const;
+        constexpr T2 evaluate() const;
+
+        /**
+         * \brief Hash of the canonical form
+         * \return A hash value mixing the numerator and the denominator
+         */
+        constexpr std::size_t hash() const;
 
         /**
          * \brief Assignment operator
          * \param[in] frac The fraction to be assigned
          * \return The fraction assigned
          */
-        Fraction<T1, T2> &operator=(const Fraction<T1, T2> &frac);
+        constexpr Fraction<T1, T2, Policy> &operator=(const Fraction<T1, T2, Policy> &frac) = default;
 
         /**
          * \brief Overloading of + operator
          * \param[in] number An integer of type T1
          * \return The new fraction
         */
-        Fraction<T1, T2> operator+(T1 number);
+        constexpr Fraction<T1, T2, Policy> operator+(T1 number) const;
 
         /**
          * \brief Overloading of + operator
          * \param[in] frac The fraction to be added
          * \return The new fraction
          */
-        Fraction<T1, T2> operator+(const Fraction<T1, T2> &frac);
+        constexpr Fraction<T1, T2, Policy> operator+(const Fraction<T1, T2, Policy> &frac) const;
 
         /**
          * \brief Overloading of += operator
          * \param[in] number An integer of type T1
          * \return A reference to the modified fraction
          */
-        Fraction<T1, T2> &operator+=(T1 number);
+        constexpr Fraction<T1, T2, Policy> &operator+=(T1 number);
 
         /**
          * \brief Overloading of += operator
          * \param[in] frac The fraction to be added
          * \return A reference to the modified fraction
          */
-        Fraction<T1, T2> &operator+=(const Fraction<T1, T2> &frac);
+        constexpr Fraction<T1, T2, Policy> &operator+=(const Fraction<T1, T2, Policy> &frac);
         
         /**
          * \brief Overloading of - operator
          * \param[in] number An integer of type T1
          * \return The new fraction
          */
-        Fraction<T1, T2> operator-(T1 number);
+        constexpr Fraction<T1, T2, Policy> operator-(T1 number) const;
 
         /**
          * \brief Overloading of - operator
          * \param[in] frac The fraction to subtract
          * \return The new fraction
          */
-        Fraction<T1, T2> operator-(const Fraction<T1, T2> &frac);
+        constexpr Fraction<T1, T2, Policy> operator-(const Fraction<T1, T2, Policy> &frac) const;
 
         /**
          * \brief Overloading of unary - operator
          * \return The opposite of the fraction
          */
-        Fraction<T1, T2> operator-();
+        constexpr Fraction<T1, T2, Policy> operator-() const;
 
         /**
          * \brief Overloading of -= operator
          * \param[in] number An integer of type T1
          * \return A reference to the modified fraction
          */
-        Fraction<T1, T2> &operator-=(T1 number);
+        constexpr Fraction<T1, T2, Policy> &operator-=(T1 number);
 
         /**
          * \brief Overloading of -= operator
          * \param[in] frac The fraction to subtract
          * \return A reference to the modified fraction
          */
-        Fraction<T1, T2> &operator-=(const Fraction<T1, T2> &frac);
+        constexpr Fraction<T1, T2, Policy> &operator-=(const Fraction<T1, T2, Policy> &frac);
 
         /**
          * \brief Overloading of * operator
          * \param[in] number An integer of type T1
          * \return The fraction multiplied by T1
          */
-        Fraction<T1, T2> operator*(T1);
+        constexpr Fraction<T1, T2, Policy> operator*(T1 number) const;
 
         /**
          * \brief Overloading of * operator
          * \param[in] frac The fraction to multiply with
          * \return The fraction multiplied by frac
          */
-        Fraction<T1, T2> operator*(const Fraction<T1, T2> &frac);
+        constexpr Fraction<T1, T2, Policy> operator*(const Fraction<T1, T2, Policy> &frac) const;
 
         /**
          * \brief Overloading of *= operator
          * \param[in] number An integer of type T1
          * \return A reference to the new fraction
          */
-        Fraction<T1, T2> &operator*=(T1 number);
+        constexpr Fraction<T1, T2, Policy> &operator*=(T1 number);
 
         /**
          * \brief Overloading of *= operator
          * \param[in] frac The fraction to multiply with
          * \return A reference to the new fraction
          */
-        Fraction<T1, T2> &operator*=(const Fraction<T1, T2> &frac);
+        constexpr Fraction<T1, T2, Policy> &operator*=(const Fraction<T1, T2, Policy> &frac);
 
         /**
          * Overloading of / operator
          * \param[in] number An integer of type T1
          * \return The fraction divided by number
          */
-        Fraction<T1, T2> operator/(T1 number);
+        constexpr Fraction<T1, T2, Policy> operator/(T1 number) const;
 
         /**
          * \brief Overloading of / operator
          * \param[in] frac The fraction to divide by
          * \return The fraction divided by frac
          */
-        Fraction<T1, T2> operator/(const Fraction<T1, T2> &frac);
+        constexpr Fraction<T1, T2, Policy> operator/(const Fraction<T1, T2, Policy> &frac) const;
 
         /**
          * \brief Overloading of /= operator
          * \param[in] number An integer of type T1
          * \return A reference to the new fraction
          */
-        Fraction<T1, T2> &operator/=(T1 number);
+        constexpr Fraction<T1, T2, Policy> &operator/=(T1 number);
 
         /**
          * \brief Overloading of /= operator
          * \param[in] frac The fraction to divide by
          * \return A reference to the new fraction
          */
-        Fraction<T1, T2> &operator/=(const Fraction<T1, T2> &frac);
+        constexpr Fraction<T1, T2, Policy> &operator/=(const Fraction<T1, T2, Policy> &frac);
+
+        /**
+         * \brief Three-way comparison, without overflow
+         * \param[in] frac The fraction to be compared with
+         * \return -1, 0 or 1 as the fraction is less than, equal to or greater than frac
+         *
+         * Signs and equal denominators are checked first, then the values in
+         * double precision when they are far enough apart. Only close values
+         * are compared exactly, by cross products in the wider integer type
+         * or by continued fraction expansions.
+         */
+        constexpr int compare(const Fraction<T1, T2, Policy> &frac) const;
+
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+        /**
+         * \brief Overloading of <=> operator
+         * \param[in] frac The fraction to be compared with
+         * \return The ordering of the fraction with respect to frac
+         */
+        constexpr std::strong_ordering operator<=>(const Fraction<T1, T2, Policy> &frac) const;
+#endif
 
         /**
          * \brief Overloading of == operator
          * \param[in] frac The fraction to be check
          * \return True if both fractions are equal, else False
          */
-        bool operator==(const Fraction<T1, T2> &frac);
+        constexpr bool operator==(const Fraction<T1, T2, Policy> &frac) const;
+
+        /**
+         * \brief Overloading of != operator
+         * \param[in] frac The fraction to be check
+         * \return True if both fractions are different, else False
+         */
+        constexpr bool operator!=(const Fraction<T1, T2, Policy> &frac) const;
 
         /**
          * \brief Overloading of > operator
          * \param[in] frac The fraction to be checked
          * \return True if fraction greater than frac, else False
          */
-        bool operator>(const Fraction<T1, T2> &frac);
+        constexpr bool operator>(const Fraction<T1, T2, Policy> &frac) const;
 
         /**
          * \brief Overloading or >= operator
          * \param[in] frac The fraction to be checked
          * \return True if fraction greater than or equa to frac, else False
          */
-        bool operator>=(const Fraction<T1, T2> &frac);
+        constexpr bool operator>=(const Fraction<T1, T2, Policy> &frac) const;
 
         /**
          * Overloading of < operator
          * \param[in] frac The fraction to be checked
          * \return True if fraction less than frac, else False
          */
-        bool operator<(const Fraction<T1, T2> &frac);
+        constexpr bool operator<(const Fraction<T1, T2, Policy> &frac) const;
 
         /**
          * \brief Overloading of <= operator
          * \param[in] frac The fraction to be checked
          * \return True if fraction less than or equal to frac, else False
          */
-        bool operator<=(const Fraction<T1, T2> &frac);
+        constexpr bool operator<=(const Fraction<T1, T2, Policy> &frac) const;
     };
 
 
@@ -285,9 +1131,53 @@ namespace frac
     /******************
      * Implementation *
      ******************/
-    template <class T1, class T2>
-    std::ostream &operator<<(std::ostream &o, const Fraction<T1, T2> &frac)
+    template <class OnOverflow>
+    template <class T>
+    constexpr T CheckedArithmetic<OnOverflow>::add(T a, T b, bool &overflow)
+    {
+        if constexpr (detail::IsBuiltinInteger<T>::value)
+        {
+            T r = 0;
+            overflow |= __builtin_add_overflow(a, b, &r);
+            return r;
+        } else
+            return a + b;
+    }
+
+
+    template <class OnOverflow>
+    template <class T>
+    constexpr T CheckedArithmetic<OnOverflow>::sub(T a, T b, bool &overflow)
     {
+        if constexpr (detail::IsBuiltinInteger<T>::value)
+        {
+            T r = 0;
+            overflow |= __builtin_sub_overflow(a, b, &r);
+            return r;
+        } else
+            return a - b;
+    }
+
+
+    template <class OnOverflow>
+    template <class T>
+    constexpr T CheckedArithmetic<OnOverflow>::mul(T a, T b, bool &overflow)
+    {
+        if constexpr (detail::IsBuiltinInteger<T>::value)
+        {
+            T r = 0;
+            overflow |= __builtin_mul_overflow(a, b, &r);
+            return r;
+        } else
+            return a * b;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::ostream &operator<<(std::ostream &o, const Fraction<T1, T2, Policy> &frac)
+    {
+        frac.canonicalize();
+
         // More convenient display for integers
         if (frac.denominator == 1)
             o << frac.numerator;
@@ -298,8 +1188,8 @@ namespace frac
     }
 
 
-    template <class T1, class T2>
-    std::istream &operator>>(std::istream &i, Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    std::istream &operator>>(std::istream &i, Fraction<T1, T2, Policy> &frac)
     {
         T1 num, denom;
 
@@ -308,362 +1198,739 @@ namespace frac
         std::cout << "Denominator: ";
         i >> denom;
 
-        frac = Fraction<T1, T2>(num, denom);
+        frac = Fraction<T1, T2, Policy>(num, denom);
 
         return i;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2>::Fraction()
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy>::Fraction()
     {
         numerator = 0;
         denominator = 1;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2>::Fraction(T1 num)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy>::Fraction(T1 num)
     {
+        // num/1 is already irreducible
         numerator = num;
         denominator = 1;
-
-        this->reduce();
     }
 
     
-    template <class T1, class T2>
-    Fraction<T1, T2>::Fraction(T1 num, T1 denom)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy>::Fraction(T1 num, T1 denom)
     {
         assertm(denom != 0, "Denominator should not be zero");
 
+        typedef typename Policy::arithmetic A;
+
         // Normalization of the sign of the fraction
-        if ((num >= 0 && denom <= 0) || (num <= 0 && denom <= 0))
+        if (denom < 0)
         {
-            numerator = -num;
-            denominator = -denom;
+            bool overflow = false;
+            numerator = A::sub(T1(0), num, overflow);
+            denominator = A::sub(T1(0), denom, overflow);
+
+            if constexpr (A::checked)
+            {
+                if (overflow)
+                    A::handler::overflow();
+            }
         } else {
             numerator = num;
             denominator = denom;
         }
 
-        this->reduce();
+        this->settle();
     }
 
 
-    // TODO: add some assertion to check if out of bound
-    // to avoid being stuck in an infinite loop
-    // Or add a max_iter number or check if there is a change of sign
-    // of the numerator or denominator
-    template <class T1, class T2>
-    Fraction<T1, T2>::Fraction(T2 floating_number)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy>::Fraction(T2 floating_number)
     {
-        // Continued fractions
-        T2 alpha(floating_number), theta(0), tmp(0);
-        std::vector<T1> p = {0, 1, 0};   // Sequence for the numerator
-        std::vector<T1> q = {1, 0, 0};   // Sequence for the denominator
-        bool complete = false;
-        
-        while (!complete)
+        this->approximateFrom(floating_number, T1(0), T2(0));
+    }
+
+
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy>::Fraction(T1 num, T1 denom, Irreducible)
+    {
+        assertm(denom > 0, "Denominator should be positive");
+
+        numerator = num;
+        denominator = denom;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    template <std::intmax_t N, std::intmax_t D>
+    constexpr Fraction<T1, T2, Policy>::Fraction(std::ratio<N, D> ratio)
+    {
+        // std::ratio is already irreducible with a positive denominator
+        (void) ratio;
+        numerator = T1(std::ratio<N, D>::num);
+        denominator = T1(std::ratio<N, D>::den);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> Fraction<T1, T2, Policy>::approximate(T2 floating_number, T1 max_denominator, T2 tolerance)
+    {
+        assertm(max_denominator >= 0, "Maximal denominator should not be negative");
+
+        Fraction tmp;
+        tmp.approximateFrom(floating_number, max_denominator, tolerance);
+
+        return tmp;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    constexpr void Fraction<T1, T2, Policy>::approximateFrom(T2 floating_number, T1 max_denominator, T2 tolerance)
+    {
+        typedef typename Policy::arithmetic A;
+        typedef typename detail::ExpansionInteger<T1>::type U;
+        assert(floating_number == floating_number && "Cannot convert NaN to a fraction");
+
+        const bool negative = floating_number < 0;
+        const T2 x = negative ? -floating_number : floating_number;
+        const T1 max_numerator = detail::largest<T1>();
+        const bool bounded = max_numerator > 0;     // 0 for unbounded integer types
+
+        // Without a bound, the first convergent evaluating to the number is enough
+        const bool first = !(max_denominator > 0);
+        if (first)
+            max_denominator = max_numerator;
+
+        if (bounded && !(x < T2(max_numerator) + T2(1)))
         {
-            // Computation of the continued fraction
-            tmp = floor(alpha);
-            theta = alpha - tmp;
-            if (theta > 1e-9)   // Precision for theta to be zero
-                alpha = 1 / theta;
-            else
-                complete = true;
+            // Saturation, infinities included
+            if constexpr (A::checked)
+                A::handler::overflow();
+
+            numerator = negative ? -max_numerator : max_numerator;
+            denominator = 1;
+            return;
+        }
 
-            // Computation of the numerator and denominator
-            p[2] = tmp * p[1] + p[0];
-            q[2] = tmp * q[1] + q[0];
+        // Exact value x = n / 2^k, doubled until it is an integer: every
+        // floating number beyond 2^63 is one
+        const unsigned int maxShift = detail::ExpansionInteger<T1>::maxShift;
+        T2 scaled = x;
+        unsigned int k = 0;
+        while (scaled < T2(9223372036854775808.0) && T2((unsigned long long) scaled) != scaled)
+        {
+            if (bounded && k > unsigned(std::numeric_limits<T1>::digits) && scaled < T2(1))
+            {
+                // Below 2^-(digits + 1), 0 is closer than any 1 / q
+                numerator = 0;
+                denominator = 1;
+                return;
+            }
 
-            // Shifting the terms of the sequence (recurring of order 2)
-            p[0] = p[1];
-            p[1] = p[2];
-            q[0] = q[1];
-            q[1] = q[2];
+            if (maxShift != 0 && k == maxShift)
+            {
+                // 2^k would not fit: rounded to the last representable bit, only for integers wider than 64 bits
+                scaled = T2((unsigned long long) (scaled + T2(0.5)));
+                break;
+            }
+
+            // 16 bits at a time while the shift stays far from its bounds, trailing zeros being harmless
+            if (scaled < T2(140737488355328.0) && (maxShift == 0 || k + 16 <= maxShift))
+            {
+                scaled *= T2(65536);
+                k += 16;
+            } else {
+                scaled *= 2;
+                k++;
+            }
         }
 
-        // Normalization of the sign of the fraction
-        if ((p[2] >= 0 && q[2] <= 0) || (p[2] <= 0 && q[2] <= 0))
+        // Continued fraction on the integers: convergents p1/q1, previous ones p0/q0,
+        // complete quotient n/d
+        U n = U(scaled), d = U(1) << k;
+        U p0(0), p1(1), q0(1), q1(0);
+        const U max_p = U(max_numerator), max_q = U(max_denominator);
+
+        for (;;)
         {
-            numerator = -p[2];
-            denominator = -q[2];
-        } else {
-            numerator = p[2];
-            denominator = q[2];
+            U a(0), r(0);
+            if constexpr (detail::IsBuiltinInteger<U>::value && sizeof(U) > 8)
+            {
+                // 64-bit division once both terms fit
+                if (((n | d) >> 64) == 0)
+                {
+                    unsigned long long n64 = (unsigned long long) n, d64 = (unsigned long long) d;
+                    a = n64 / d64;
+                    r = n64 % d64;
+                } else {
+                    a = n / d;
+                    r = n - a * d;
+                }
+            } else {
+                a = n / d;
+                r = n - a * d;
+            }
+
+            if (max_denominator > 0 && q1 != U(0))
+            {
+                // Largest quotient keeping both terms within their bounds
+                U limit = (max_q - q0) / q1;
+                if (bounded && p1 != U(0) && (max_p - p0) / p1 < limit)
+                    limit = (max_p - p0) / p1;
+
+                if (limit < a)
+                {
+                    // The semiconvergent of quotient limit is strictly closer than the
+                    // convergent if and only if n / d < 2 * limit + q0 / q1
+                    U twice = limit + limit;
+                    if (a < twice || (a == twice && detail::lessRatio(r, d, q0, q1)))
+                    {
+                        p1 = p0 + limit * p1;
+                        q1 = q0 + limit * q1;
+                    }
+                    break;
+                }
+            }
+
+            U p2 = a * p1 + p0, q2 = a * q1 + q0;
+            p0 = p1;
+            p1 = p2;
+            q0 = q1;
+            q1 = q2;
+
+            n = d;
+            d = r;
+            if (d == U(0))
+                break;
+
+            if (first || tolerance > 0)
+            {
+                T2 value = detail::quotient<T2>(T1(p1), T1(q1));
+                T2 error = value < x ? x - value : value - x;
+                if ((first && value == x) || (tolerance > 0 && error <= tolerance))
+                    break;
+            }
         }
+
+        // Convergents are irreducible with a positive denominator
+        numerator = negative ? -T1(p1) : T1(p1);
+        denominator = T1(q1);
     }
 
 
-    template <class T1, class T2>
-    T1 Fraction<T1, T2>::getNum() const
+    template <class T1, class T2, class Policy>
+    constexpr void Fraction<T1, T2, Policy>::settle(const Fraction<T1, T2, Policy> *other)
     {
-        return numerator;
+        if constexpr (!Policy::reduction::lazy)
+            this->reduce();
+        else {
+            unsigned int count = this->pending;
+            if (other != nullptr && other->pending > count)
+                count = other->pending;
+            count += 1;
+
+            if (Policy::reduction::due(count, numerator, denominator))
+                this->reduce();
+            else if (count != 0)    // Saturation rather than wrapping to "irreducible"
+                this->pending = count;
+        }
     }
 
 
-    template <class T1, class T2>
-    T1 Fraction<T1, T2>::getDenom() const
+    template <class T1, class T2, class Policy>
+    constexpr void Fraction<T1, T2, Policy>::canonicalize() const
     {
-        return denominator;
+        if constexpr (Policy::reduction::lazy)
+        {
+            if (this->pending != 0)
+                const_cast<Fraction<T1, T2, Policy> *>(this)->reduce();
+        }
     }
 
 
-    template <class T1, class T2>
-    void Fraction<T1, T2>::reduce()
+    template <class T1, class T2, class Policy>
+    template <detail::Operation op>
+    constexpr void Fraction<T1, T2, Policy>::apply(T1 num, T1 denom, const Fraction<T1, T2, Policy> *other)
     {
-        // Using Euclide's algorithm
-        T1 a(abs(numerator)), b(abs(denominator));
+        typedef typename Policy::arithmetic A;
+        typedef typename detail::Wider<T1>::type W;
 
-        if (a > 0 && b > 0) {
-            while (a != b)
+        T1 n(numerator), d(denominator);
+        bool overflow = false;
+
+        compute<op, A>(n, d, num, denom, overflow);
+
+        if constexpr (A::checked)
+        {
+            if (overflow)
             {
-                if (a > b)  a -= b;
-                else        b -= a;
-            }
+                if constexpr (A::widening && !std::is_void<W>::value)
+                {
+                    if (this->template widen<op, W>(num, denom))
+                        return;
+                }
 
-            numerator /= a;
-            denominator /= a;
+                A::handler::overflow();
+            }
         }
+
+        numerator = n;
+        denominator = d;
+
+        if constexpr (Policy::reduction::lazy)
+            this->settle(other);
     }
 
 
-    template <class T1, class T2>
-    T2 Fraction<T1, T2>::evaluate() const
+    template <class T1, class T2, class Policy>
+    template <detail::Operation op, class W>
+    constexpr bool Fraction<T1, T2, Policy>::widen(T1 num, T1 denom)
     {
-        return (T2) numerator / denominator;
+        W n(numerator), d(denominator);
+        bool overflow = false;
+
+        compute<op, UncheckedArithmetic>(n, d, num, denom, overflow);
+
+        W g = Policy::gcd::compute(n, d);
+        if (g > 1) {
+            n /= g;
+            d /= g;
+        }
+
+        const W lowest(std::numeric_limits<T1>::min()), highest(std::numeric_limits<T1>::max());
+        if (n < lowest || n > highest || d > highest)
+            return false;
+
+        numerator = T1(n);
+        denominator = T1(d);
+
+        if constexpr (Policy::reduction::lazy)
+            this->pending = 0;
+
+        return true;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> &Fraction<T1, T2>::operator=(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    template <detail::Operation op, class A, class I>
+    constexpr void Fraction<T1, T2, Policy>::compute(I &n, I &d, T1 num, T1 denom, bool &overflow)
     {
-        if (this != &frac)
+        typedef detail::Operation Op;
+        const bool lazy = Policy::reduction::lazy;
+
+        if constexpr (op == Op::Add || op == Op::Sub)
         {
-            numerator = frac.numerator;
-            denominator = frac.denominator;
+            I b(denom), a = (op == Op::Sub) ? A::sub(I(0), I(num), overflow) : I(num);
+
+            if (lazy && d == b)
+                n = A::add(n, a, overflow);
+            else {
+                I d1 = lazy ? I(1) : Policy::gcd::compute(d, b);
+
+                if (d1 == 1) {
+                    // Coprime denominators: nothing can cancel
+                    n = A::add(A::mul(n, b, overflow), A::mul(d, a, overflow), overflow);
+                    d = A::mul(d, b, overflow);
+                } else {
+                    // Only a factor of d1 may divide the new numerator
+                    I t = A::add(A::mul(n, I(b / d1), overflow), A::mul(a, I(d / d1), overflow), overflow);
+                    I d2 = Policy::gcd::compute(t, d1);
+
+                    n = t / d2;
+                    d = A::mul(I(d / d1), I(b / d2), overflow);
+                }
+            }
         }
+        else if constexpr (op == Op::Mul || op == Op::Div)
+        {
+            I a(num), b(denom);
 
-        this->reduce();
+            // Multiplication by the inverse
+            if (op == Op::Div)
+            {
+                a = I(denom);
+                b = I(num);
+            }
 
-        return *this;
-    }
+            if (!lazy) {
+                // Cross-cancellation of the numerators with the denominators
+                I g1 = Policy::gcd::compute(n, b);
+                I g2 = Policy::gcd::compute(a, d);
 
+                n /= g1;
+                d /= g2;
+                a /= g2;
+                b /= g1;
+            }
 
-    template <class T1, class T2>
-    Fraction<T1, T2> Fraction<T1, T2>::operator+(T1 number)
-    {
-        return Fraction(numerator + number * denominator, denominator);
+            // Sign of the inverse carried by the numerator, once cancelled as the most negative divisor has no opposite
+            if (op == Op::Div && b < 0)
+            {
+                a = A::sub(I(0), a, overflow);
+                b = A::sub(I(0), b, overflow);
+            }
+
+            n = A::mul(n, a, overflow);
+            d = A::mul(d, b, overflow);
+        }
+        else if constexpr (op == Op::AddInt || op == Op::SubInt)
+        {
+            // gcd(n + k * d, d) = gcd(n, d), nothing to reduce
+            I k = A::mul(d, I(num), overflow);
+            n = (op == Op::AddInt) ? A::add(n, k, overflow) : A::sub(n, k, overflow);
+        }
+        else if constexpr (op == Op::MulInt)
+        {
+            I k(num);
+
+            if (lazy)
+                n = A::mul(n, k, overflow);
+            else {
+                // Only k and the denominator may share a factor
+                I g = Policy::gcd::compute(k, d);
+                n = A::mul(n, I(k / g), overflow);
+                d /= g;
+            }
+        }
+        else
+        {
+            I k(num);
+
+            // Only k and the numerator may share a factor, cancelled even when lazy
+            // if k is negative as the most negative divisor has no opposite
+            if (!lazy || k < 0) {
+                I g = Policy::gcd::compute(n, k);
+                n /= g;
+                k /= g;
+            }
+
+            // Sign of k carried by the numerator
+            if (k < 0)
+            {
+                n = A::sub(I(0), n, overflow);
+                k = A::sub(I(0), k, overflow);
+            }
+
+            d = A::mul(d, k, overflow);
+        }
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> Fraction<T1, T2>::operator+(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr bool Fraction<T1, T2, Policy>::isPending() const
     {
-        if (denominator == frac.denominator)
-            return Fraction(numerator + frac.numerator, denominator);
+        if constexpr (Policy::reduction::lazy)
+            return this->pending != 0;
         else
-            return Fraction(numerator * frac.denominator + denominator * frac.numerator, denominator * frac.denominator);
+            return false;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> &Fraction<T1, T2>::operator+=(T1 number)
+    template <class T1, class T2, class Policy>
+    constexpr T1 Fraction<T1, T2, Policy>::getNum() const
     {
-        numerator += denominator * number;
-        this->reduce();
+        this->canonicalize();
+        return numerator;
+    }
 
-        return *this;
+
+    template <class T1, class T2, class Policy>
+    constexpr T1 Fraction<T1, T2, Policy>::getDenom() const
+    {
+        this->canonicalize();
+        return denominator;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> &Fraction<T1, T2>::operator+=(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr void Fraction<T1, T2, Policy>::reduce()
     {
-        if (denominator == frac.denominator)
-            numerator += frac.numerator;
-        else {
-            numerator = numerator * frac.denominator + denominator * frac.numerator;
-            denominator *= frac.denominator;
+        // The engine works on magnitudes, gcd(0, denom) = |denom| gives 0/1
+        T1 g = Policy::gcd::compute(numerator, denominator);
+
+        if (g > 1) {
+            numerator /= g;
+            denominator /= g;
         }
-        
-        this->reduce();
 
-        return *this;
+        if constexpr (Policy::reduction::lazy)
+            this->pending = 0;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> Fraction<T1, T2>::operator-(T1 number)
+    template <class T1, class T2, class Policy>
+    constexpr T2 Fraction<T1, T2, Policy>::evaluate() const
     {
-        return Fraction(numerator - number * denominator, denominator);
+        return detail::quotient<T2>(numerator, denominator);
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> Fraction<T1, T2>::operator-(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr std::size_t Fraction<T1, T2, Policy>::hash() const
     {
-        if (denominator == frac.denominator)
-            return Fraction(numerator - frac.numerator, denominator);
-        else
-            return Fraction(numerator * frac.denominator - denominator * frac.numerator, denominator * frac.denominator);
+        this->canonicalize();
+
+        return std::size_t(detail::mixHash(detail::hashOf(numerator), detail::hashOf(denominator)));
+    }
+
+
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> Fraction<T1, T2, Policy>::operator+(T1 number) const
+    {
+        Fraction tmp(*this);
+        return tmp += number;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> Fraction<T1, T2>::operator-()
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> Fraction<T1, T2, Policy>::operator+(const Fraction<T1, T2, Policy> &frac) const
     {
-        return Fraction(-numerator, denominator);
+        Fraction tmp(*this);
+        return tmp += frac;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> &Fraction<T1, T2>::operator-=(T1 number)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> &Fraction<T1, T2, Policy>::operator+=(T1 number)
     {
-        numerator -= denominator * number;
-        this->reduce();
+        this->template apply<detail::Operation::AddInt>(number, T1(1));
 
         return *this;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> &Fraction<T1, T2>::operator-=(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> &Fraction<T1, T2, Policy>::operator+=(const Fraction<T1, T2, Policy> &frac)
     {
-        if (denominator == frac.denominator)
-            numerator -= frac.numerator;
-        else {
-            numerator = numerator * frac.denominator - denominator * frac.numerator;
-            denominator *= frac.denominator;
+        this->template apply<detail::Operation::Add>(frac.numerator, frac.denominator, &frac);
+
+        return *this;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> Fraction<T1, T2, Policy>::operator-(T1 number) const
+    {
+        Fraction tmp(*this);
+        return tmp -= number;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> Fraction<T1, T2, Policy>::operator-(const Fraction<T1, T2, Policy> &frac) const
+    {
+        Fraction tmp(*this);
+        return tmp -= frac;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> Fraction<T1, T2, Policy>::operator-() const
+    {
+        typedef typename Policy::arithmetic A;
+
+        // The opposite of an irreducible fraction is irreducible
+        Fraction tmp(*this);
+        bool overflow = false;
+        tmp.numerator = A::sub(T1(0), numerator, overflow);
+
+        if constexpr (A::checked)
+        {
+            if (overflow)
+                A::handler::overflow();
         }
 
-        this->reduce();
+        return tmp;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> &Fraction<T1, T2, Policy>::operator-=(T1 number)
+    {
+        this->template apply<detail::Operation::SubInt>(number, T1(1));
+
+        return *this;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> &Fraction<T1, T2, Policy>::operator-=(const Fraction<T1, T2, Policy> &frac)
+    {
+        this->template apply<detail::Operation::Sub>(frac.numerator, frac.denominator, &frac);
 
         return *this;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> Fraction<T1, T2>::operator*(T1 number)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> Fraction<T1, T2, Policy>::operator*(T1 number) const
     {
-        return Fraction(number * numerator, denominator);
+        Fraction tmp(*this);
+        return tmp *= number;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> Fraction<T1, T2>::operator*(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> Fraction<T1, T2, Policy>::operator*(const Fraction<T1, T2, Policy> &frac) const
     {
-        return Fraction(numerator * frac.numerator,
-                        denominator * frac.denominator);
+        Fraction tmp(*this);
+        return tmp *= frac;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> &Fraction<T1, T2>::operator*=(T1 number)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> &Fraction<T1, T2, Policy>::operator*=(T1 number)
     {
-        numerator *= number;
-        this->reduce();
+        this->template apply<detail::Operation::MulInt>(number, T1(1));
 
         return *this;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> &Fraction<T1, T2>::operator*=(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> &Fraction<T1, T2, Policy>::operator*=(const Fraction<T1, T2, Policy> &frac)
     {
-        numerator *= frac.numerator;
-        denominator *= frac.denominator;
-
-        this->reduce();
+        this->template apply<detail::Operation::Mul>(frac.numerator, frac.denominator, &frac);
 
         return *this;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> Fraction<T1, T2>::operator/(T1 number)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> Fraction<T1, T2, Policy>::operator/(T1 number) const
     {
-        assertm(number != 0, "Error: division by zero");
-        return Fraction(numerator, denominator * number);
+        Fraction tmp(*this);
+        return tmp /= number;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> Fraction<T1, T2>::operator/(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> Fraction<T1, T2, Policy>::operator/(const Fraction<T1, T2, Policy> &frac) const
     {
-        assertm(frac.numerator != 0, "Error: division by zero");
-        return Fraction(numerator * frac.denominator,
-                        denominator * frac.numerator);
+        Fraction tmp(*this);
+        return tmp /= frac;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> &Fraction<T1, T2>::operator/=(T1 number)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> &Fraction<T1, T2, Policy>::operator/=(T1 number)
     {
         assertm(number != 0, "Error: division by zero");
-        denominator *= number;
-
-        this->reduce();
+        this->template apply<detail::Operation::DivInt>(number, T1(1));
 
         return *this;
     }
 
 
-    template <class T1, class T2>
-    Fraction<T1, T2> &Fraction<T1, T2>::operator/=(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr Fraction<T1, T2, Policy> &Fraction<T1, T2, Policy>::operator/=(const Fraction<T1, T2, Policy> &frac)
     {
         assertm(frac.numerator != 0, "Error: division by zero");
-        numerator *= frac.denominator;
-        denominator *= frac.numerator;
-
-        this->reduce();
+        this->template apply<detail::Operation::Div>(frac.numerator, frac.denominator, &frac);
 
         return *this;
     }
 
 
-    template <class T1, class T2>
-    bool Fraction<T1, T2>::operator==(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr int Fraction<T1, T2, Policy>::compare(const Fraction<T1, T2, Policy> &frac) const
     {
+        // Signs, denominators are positive
+        const int sign = (T1(0) < numerator) - (numerator < T1(0));
+        const int other = (T1(0) < frac.numerator) - (frac.numerator < T1(0));
+        if (sign != other)
+            return sign < other ? -1 : 1;
+        if (sign == 0)
+            return 0;
+
+        if (denominator == frac.denominator)
+            return numerator < frac.numerator ? -1 : (frac.numerator < numerator ? 1 : 0);
+
+        if constexpr (detail::IsBuiltinInteger<T1>::value)
+        {
+            // Floating filter: each quotient has a relative error below 2^-51
+            double a = double(numerator) / double(denominator);
+            double b = double(frac.numerator) / double(frac.denominator);
+            double margin = (a < 0 ? -a - b : a + b) * 0x1p-50;
+            if (a - b > margin)
+                return 1;
+            if (b - a > margin)
+                return -1;
+
+            typedef typename detail::Wider<T1>::type W;
+            if constexpr (!std::is_void<W>::value)
+            {
+                W left = W(numerator) * W(frac.denominator), right = W(frac.numerator) * W(denominator);
+                return left < right ? -1 : (right < left ? 1 : 0);
+            } else {
+                int order = detail::compareExpansions(detail::magnitude(numerator), detail::magnitude(denominator),
+                                                      detail::magnitude(frac.numerator), detail::magnitude(frac.denominator));
+                return sign > 0 ? order : -order;
+            }
+        } else {
+            // Arbitrary precision: cross products cannot overflow
+            T1 left = numerator * frac.denominator, right = frac.numerator * denominator;
+            return left < right ? -1 : (right < left ? 1 : 0);
+        }
+    }
+
+
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+    template <class T1, class T2, class Policy>
+    constexpr std::strong_ordering Fraction<T1, T2, Policy>::operator<=>(const Fraction<T1, T2, Policy> &frac) const
+    {
+        return this->compare(frac) <=> 0;
+    }
+#endif
+
+
+    template <class T1, class T2, class Policy>
+    constexpr bool Fraction<T1, T2, Policy>::operator==(const Fraction<T1, T2, Policy> &frac) const
+    {
+        this->canonicalize();
+        frac.canonicalize();
+
         return (numerator == frac.numerator) && (denominator == frac.denominator);
     }
 
 
-    template <class T1, class T2>
-    bool Fraction<T1, T2>::operator>(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr bool Fraction<T1, T2, Policy>::operator!=(const Fraction<T1, T2, Policy> &frac) const
     {
-        if (denominator == frac.denominator)
-            return numerator > frac.numerator;
-        else {
-            Fraction tmp1(numerator * frac.denominator,
-                          denominator * frac.denominator);
-            Fraction tmp2(frac.numerator * denominator,
-                          frac.denominator * denominator);
-            return tmp1.numerator > tmp2.denominator;
-        }
+        return !(*this == frac);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    constexpr bool Fraction<T1, T2, Policy>::operator>(const Fraction<T1, T2, Policy> &frac) const
+    {
+        return this->compare(frac) > 0;
     }
 
 
-    template <class T1, class T2>
-    bool Fraction<T1, T2>::operator>=(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr bool Fraction<T1, T2, Policy>::operator>=(const Fraction<T1, T2, Policy> &frac) const
     {
-        return (*this > frac) || (*this == frac);
+        return this->compare(frac) >= 0;
     }
 
 
-    template <class T1, class T2>
-    bool Fraction<T1, T2>::operator<(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr bool Fraction<T1, T2, Policy>::operator<(const Fraction<T1, T2, Policy> &frac) const
     {
-        return !(*this >= frac);
+        return this->compare(frac) < 0;
     }
 
 
-    template <class T1, class T2>
-    bool Fraction<T1, T2>::operator<=(const Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr bool Fraction<T1, T2, Policy>::operator<=(const Fraction<T1, T2, Policy> &frac) const
     {
-        return !(*this > frac);
+        return this->compare(frac) <= 0;
     }
 }
 
@@ -678,4 +1945,60 @@ typedef frac::Fraction<long int, float> FractionLF;     /*!< Fraction of long in
 typedef frac::Fraction<long int, double> FractionLD;    /*!< Fraction of long int whose value is evaluated in double precision */
 
 
+
+/********
+ * Hash *
+ ********/
+namespace std
+{
+    /**
+     * \struct hash<frac::Fraction<T1, T2, Policy>>
+     * \brief Hash of fractions for unordered containers, equal fractions have equal hashes
+     */
+    template <class T1, class T2, class Policy>
+    struct hash<frac::Fraction<T1, T2, Policy>>
+    {
+        std::size_t operator()(const frac::Fraction<T1, T2, Policy> &frac) const
+        {
+            return frac.hash();
+        }
+    };
+}
+
+
+
+/************
+ * Literals *
+ ************/
+namespace frac
+{
+    /**
+     * \namespace frac::literals
+     * \brief User-defined literals for compile time rationals, as in 3_fr / 4
+     */
+    inline namespace literals
+    {
+        /**
+         * \brief Integer literal as a FractionLD
+         * \param[in] n The integer
+         * \return n/1
+         */
+        constexpr FractionLD operator"" _fr(unsigned long long n)
+        {
+            return FractionLD((long int) n);
+        }
+
+        /**
+         * \brief Floating literal as a FractionLD, through its continued fraction
+         * \param[in] x The floating number
+         * \return The rational approximation of x
+         */
+        constexpr FractionLD operator"" _fr(long double x)
+        {
+            return FractionLD((double) x);
+        }
+    }
+}
+
+
 #endif  /*_FRACTION_H_*/
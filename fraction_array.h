@@ -0,0 +1,815 @@
+#ifndef _FRACTION_ARRAY_H_
+#define _FRACTION_ARRAY_H_
+
+/**
+ * \file fraction_array.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Structure of arrays container of fractions with batch kernels
+ */
+
+#include <algorithm>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#include "fraction.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /**
+     * \class FractionArray
+     * \brief Array of fractions storing numerators and denominators in two separate arrays
+     *
+     * Element-wise operations work on whole arrays: the products are computed
+     * in plain loops, checked for overflow, then the array is reduced in one
+     * batch, with the binary GCD vectorized on AVX2 / AVX-512 for 32-bit
+     * integers. Elements whose products overflow are redone by the operator
+     * of Fraction, so that every element gets the scalar result, overflow
+     * handling of Policy::arithmetic included.
+     *
+     * Denominators are always positive. With an eager policy elements are
+     * irreducible between two operations; lazy policies skip the batch
+     * reduction, to be done by reduce().
+     */
+    template <class T1, class T2, class Policy = DefaultPolicy>
+    class FractionArray
+    {
+    private:
+        std::vector<T1> numerators;     /*!< Numerators of integer type T1 */
+        std::vector<T1> denominators;   /*!< Denominators of integer type T1 */
+
+        /**
+         * \brief Batch reduction according to the policy
+         */
+        void settle();
+
+        /**
+         * \brief Element-wise operation giving the results of the scalar one
+         * \param[in] lane Function (n, d, i, overflow) computing the unreduced terms of element i with checked products
+         * \param[in] scalar Function (frac, i) applying the operation of Fraction to element i
+         *
+         * Unreduced terms that fit in T1 give the exact result once reduced.
+         * The elements whose terms overflow are redone by the scalar
+         * operator, with its cancellations and Policy::arithmetic.
+         */
+        template <class Lane, class Scalar>
+        void apply(Lane lane, Scalar scalar);
+
+    public:
+        typedef Fraction<T1, T2, Policy> value_type;    /*!< Type of the elements */
+
+        /**
+         * \brief Default constructor, empty array
+         */
+        FractionArray();
+
+        /**
+         * \brief Constructor
+         * \param[in] size Number of elements, all equal to zero
+         */
+        explicit FractionArray(std::size_t size);
+
+        /**
+         * \brief Constructor from a list of fractions
+         * \param[in] fractions The fractions to be stored
+         */
+        FractionArray(std::initializer_list<Fraction<T1, T2, Policy>> fractions);
+
+        /**
+         * \brief Constructor from any range of fractions
+         * \param[in] first Iterator to the first fraction
+         * \param[in] last Iterator past the last fraction
+         */
+        template <class Iterator>
+        FractionArray(Iterator first, Iterator last);
+
+        /**
+         * \brief Number of elements
+         * \return The size of the array
+         */
+        std::size_t size() const;
+
+        /**
+         * \brief Change of the number of elements, new ones are zero
+         * \param[in] size The new size
+         */
+        void resize(std::size_t size);
+
+        /**
+         * \brief Reservation of memory
+         * \param[in] capacity Number of elements to make room for
+         */
+        void reserve(std::size_t capacity);
+
+        /**
+         * \brief Addition of an element at the end
+         * \param[in] frac The fraction to be added
+         */
+        void push_back(const Fraction<T1, T2, Policy> &frac);
+
+        /**
+         * \brief Element getter
+         * \param[in] i Index of the element
+         * \return The fraction at index i
+         */
+        Fraction<T1, T2, Policy> operator[](std::size_t i) const;
+
+        /**
+         * \brief Element setter
+         * \param[in] i Index of the element
+         * \param[in] frac The fraction to be stored
+         */
+        void set(std::size_t i, const Fraction<T1, T2, Policy> &frac);
+
+        /**
+         * \brief Numerators getter
+         * \return Pointer to the size() numerators
+         */
+        const T1 *numData() const;
+
+        /**
+         * \brief Denominators getter
+         * \return Pointer to the size() denominators
+         */
+        const T1 *denomData() const;
+
+        /**
+         * \brief Reduction of every element to an irreducible fraction
+         */
+        void reduce();
+
+        /**
+         * \brief Evaluation of every element, correctly rounded as Fraction::evaluate()
+         * \param[out] values Array of size() floating values of type T2
+         */
+        void evaluate(T2 *values) const;
+
+        /**
+         * \brief Evaluation of every element
+         * \return The floating values of type T2
+         */
+        std::vector<T2> evaluate() const;
+
+        /**
+         * \brief Element-wise addition
+         * \param[in] other Array of the same size
+         * \return A reference to the modified array
+         */
+        FractionArray<T1, T2, Policy> &operator+=(const FractionArray<T1, T2, Policy> &other);
+
+        /**
+         * \brief Element-wise subtraction
+         * \param[in] other Array of the same size
+         * \return A reference to the modified array
+         */
+        FractionArray<T1, T2, Policy> &operator-=(const FractionArray<T1, T2, Policy> &other);
+
+        /**
+         * \brief Element-wise multiplication
+         * \param[in] other Array of the same size
+         * \return A reference to the modified array
+         */
+        FractionArray<T1, T2, Policy> &operator*=(const FractionArray<T1, T2, Policy> &other);
+
+        /**
+         * \brief Element-wise division
+         * \param[in] other Array of the same size, without zero
+         * \return A reference to the modified array
+         */
+        FractionArray<T1, T2, Policy> &operator/=(const FractionArray<T1, T2, Policy> &other);
+
+        /**
+         * \brief Addition of the same fraction to every element
+         * \param[in] frac The fraction to be added
+         * \return A reference to the modified array
+         */
+        FractionArray<T1, T2, Policy> &operator+=(const Fraction<T1, T2, Policy> &frac);
+
+        /**
+         * \brief Subtraction of the same fraction from every element
+         * \param[in] frac The fraction to subtract
+         * \return A reference to the modified array
+         */
+        FractionArray<T1, T2, Policy> &operator-=(const Fraction<T1, T2, Policy> &frac);
+
+        /**
+         * \brief Multiplication of every element by the same fraction
+         * \param[in] frac The fraction to multiply with
+         * \return A reference to the modified array
+         */
+        FractionArray<T1, T2, Policy> &operator*=(const Fraction<T1, T2, Policy> &frac);
+
+        /**
+         * \brief Division of every element by the same fraction
+         * \param[in] frac The non zero fraction to divide by
+         * \return A reference to the modified array
+         */
+        FractionArray<T1, T2, Policy> &operator/=(const Fraction<T1, T2, Policy> &frac);
+
+        FractionArray<T1, T2, Policy> operator+(const FractionArray<T1, T2, Policy> &other) const;    /*!< \brief Element-wise addition */
+        FractionArray<T1, T2, Policy> operator-(const FractionArray<T1, T2, Policy> &other) const;    /*!< \brief Element-wise subtraction */
+        FractionArray<T1, T2, Policy> operator*(const FractionArray<T1, T2, Policy> &other) const;    /*!< \brief Element-wise multiplication */
+        FractionArray<T1, T2, Policy> operator/(const FractionArray<T1, T2, Policy> &other) const;    /*!< \brief Element-wise division */
+    };
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    namespace detail
+    {
+        /**
+         * \namespace frac::detail::simd
+         * \brief Vectorized kernels on 32-bit integers, each returns the number of elements done
+         *
+         * The remaining elements (less than a vector) are left to the scalar code.
+         */
+        namespace simd
+        {
+#if defined(__AVX512F__) && defined(__AVX512CD__)
+            /**
+             * \brief Trailing zeros of each lane, a shift count larger than 31 for zero lanes
+             */
+            inline __m512i ctz(__m512i x)
+            {
+                __m512i low = _mm512_and_si512(x, _mm512_sub_epi32(_mm512_setzero_si512(), x));
+                return _mm512_sub_epi32(_mm512_set1_epi32(31), _mm512_lzcnt_epi32(low));
+            }
+
+
+            /**
+             * \brief Exact division of 16 lanes through double precision
+             */
+            inline __m512i divExact(__m512i a, __m512i b)
+            {
+                __m256i lo = _mm512_cvttpd_epi32(_mm512_div_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(a)),
+                                                               _mm512_cvtepi32_pd(_mm512_castsi512_si256(b))));
+                __m256i hi = _mm512_cvttpd_epi32(_mm512_div_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(a, 1)),
+                                                               _mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(b, 1))));
+                return _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+            }
+
+
+            inline std::size_t reduce(int32_t *num, int32_t *denom, std::size_t count)
+            {
+                std::size_t i = 0;
+                for (; i + 16 <= count; i += 16)
+                {
+                    __m512i n = _mm512_loadu_si512(num + i), d = _mm512_loadu_si512(denom + i);
+
+                    // Binary GCD on |n| and d, gcd(0, d) = d
+                    __m512i u = _mm512_abs_epi32(n), v = d;
+                    u = _mm512_mask_blend_epi32(_mm512_cmpeq_epi32_mask(u, _mm512_setzero_si512()), u, v);
+                    __m512i shift = ctz(_mm512_or_si512(u, v));
+                    u = _mm512_srlv_epi32(u, ctz(u));
+
+                    __mmask16 active = _mm512_cmpneq_epi32_mask(v, _mm512_setzero_si512());
+                    while (active)
+                    {
+                        v = _mm512_srlv_epi32(v, ctz(v));
+                        __m512i lo = _mm512_min_epu32(u, v), hi = _mm512_max_epu32(u, v);
+                        u = _mm512_mask_blend_epi32(active, u, lo);
+                        v = _mm512_mask_blend_epi32(active, v, _mm512_sub_epi32(hi, lo));
+                        active = _mm512_cmpneq_epi32_mask(v, _mm512_setzero_si512());
+                    }
+
+                    __m512i g = _mm512_sllv_epi32(u, shift);
+                    _mm512_storeu_si512(num + i, divExact(n, g));
+                    _mm512_storeu_si512(denom + i, divExact(d, g));
+                }
+
+                return i;
+            }
+
+
+            inline std::size_t evaluate(const int32_t *num, const int32_t *denom, double *values, std::size_t count)
+            {
+                std::size_t i = 0;
+                for (; i + 8 <= count; i += 8)
+                {
+                    __m512d n = _mm512_cvtepi32_pd(_mm256_loadu_si256((const __m256i *) (num + i)));
+                    __m512d d = _mm512_cvtepi32_pd(_mm256_loadu_si256((const __m256i *) (denom + i)));
+                    _mm512_storeu_pd(values + i, _mm512_div_pd(n, d));
+                }
+
+                return i;
+            }
+
+
+            inline std::size_t evaluate(const int32_t *num, const int32_t *denom, float *values, std::size_t count)
+            {
+                std::size_t i = 0;
+                const __m512i limit = _mm512_set1_epi32(1 << 24);
+                for (; i + 16 <= count; i += 16)
+                {
+                    __m512i a = _mm512_loadu_si512(num + i), b = _mm512_loadu_si512(denom + i);
+
+                    // Exact conversions up to 2^24 only, the wider lanes are left to the scalar loop
+                    if (_mm512_cmpgt_epu32_mask(_mm512_abs_epi32(a), limit) | _mm512_cmpgt_epu32_mask(_mm512_abs_epi32(b), limit))
+                        break;
+
+                    _mm512_storeu_ps(values + i, _mm512_div_ps(_mm512_cvtepi32_ps(a), _mm512_cvtepi32_ps(b)));
+                }
+
+                return i;
+            }
+#elif defined(__AVX2__)
+            /**
+             * \brief Trailing zeros of each lane, a shift count larger than 31 for zero lanes
+             *
+             * The lowest set bit is converted to float and its exponent read back.
+             */
+            inline __m256i ctz(__m256i x)
+            {
+                __m256i low = _mm256_and_si256(x, _mm256_sub_epi32(_mm256_setzero_si256(), x));
+                __m256i exponent = _mm256_srli_epi32(_mm256_castps_si256(_mm256_cvtepi32_ps(low)), 23);
+                exponent = _mm256_and_si256(exponent, _mm256_set1_epi32(0xFF));    // 2^31 converts to a negative float
+                return _mm256_sub_epi32(exponent, _mm256_set1_epi32(127));
+            }
+
+
+            /**
+             * \brief Exact division of 8 lanes through double precision
+             */
+            inline __m256i divExact(__m256i a, __m256i b)
+            {
+                __m128i lo = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(a)),
+                                                               _mm256_cvtepi32_pd(_mm256_castsi256_si128(b))));
+                __m128i hi = _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(a, 1)),
+                                                               _mm256_cvtepi32_pd(_mm256_extracti128_si256(b, 1))));
+                return _mm256_set_m128i(hi, lo);
+            }
+
+
+            inline std::size_t reduce(int32_t *num, int32_t *denom, std::size_t count)
+            {
+                const __m256i zero = _mm256_setzero_si256();
+                std::size_t i = 0;
+
+                for (; i + 8 <= count; i += 8)
+                {
+                    __m256i n = _mm256_loadu_si256((const __m256i *) (num + i));
+                    __m256i d = _mm256_loadu_si256((const __m256i *) (denom + i));
+
+                    // Binary GCD on |n| and d, gcd(0, d) = d
+                    __m256i u = _mm256_abs_epi32(n), v = d;
+                    u = _mm256_blendv_epi8(u, v, _mm256_cmpeq_epi32(u, zero));
+                    __m256i shift = ctz(_mm256_or_si256(u, v));
+                    u = _mm256_srlv_epi32(u, ctz(u));
+
+                    while (!_mm256_testz_si256(v, v))
+                    {
+                        __m256i active = _mm256_xor_si256(_mm256_cmpeq_epi32(v, zero), _mm256_set1_epi32(-1));
+                        v = _mm256_srlv_epi32(v, ctz(v));
+                        __m256i lo = _mm256_min_epu32(u, v), hi = _mm256_max_epu32(u, v);
+                        u = _mm256_blendv_epi8(u, lo, active);
+                        v = _mm256_blendv_epi8(v, _mm256_sub_epi32(hi, lo), active);
+                    }
+
+                    __m256i g = _mm256_sllv_epi32(u, shift);
+                    _mm256_storeu_si256((__m256i *) (num + i), divExact(n, g));
+                    _mm256_storeu_si256((__m256i *) (denom + i), divExact(d, g));
+                }
+
+                return i;
+            }
+
+
+            inline std::size_t evaluate(const int32_t *num, const int32_t *denom, double *values, std::size_t count)
+            {
+                std::size_t i = 0;
+                for (; i + 4 <= count; i += 4)
+                {
+                    __m256d n = _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *) (num + i)));
+                    __m256d d = _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *) (denom + i)));
+                    _mm256_storeu_pd(values + i, _mm256_div_pd(n, d));
+                }
+
+                return i;
+            }
+
+
+            inline std::size_t evaluate(const int32_t *num, const int32_t *denom, float *values, std::size_t count)
+            {
+                std::size_t i = 0;
+                const __m256i limit = _mm256_set1_epi32(1 << 24);
+                for (; i + 8 <= count; i += 8)
+                {
+                    __m256i a = _mm256_loadu_si256((const __m256i *) (num + i));
+                    __m256i b = _mm256_loadu_si256((const __m256i *) (denom + i));
+
+                    // Exact conversions up to 2^24 only, the wider lanes are left to the scalar loop
+                    __m256i exact = _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_max_epu32(_mm256_abs_epi32(a), limit), limit),
+                                                     _mm256_cmpeq_epi32(_mm256_max_epu32(_mm256_abs_epi32(b), limit), limit));
+                    if (_mm256_movemask_epi8(exact) != -1)
+                        break;
+
+                    _mm256_storeu_ps(values + i, _mm256_div_ps(_mm256_cvtepi32_ps(a), _mm256_cvtepi32_ps(b)));
+                }
+
+                return i;
+            }
+#else
+            inline std::size_t reduce(int32_t *, int32_t *, std::size_t)
+            {
+                return 0;
+            }
+
+            template <class T2>
+            inline std::size_t evaluate(const int32_t *, const int32_t *, T2 *, std::size_t)
+            {
+                return 0;
+            }
+#endif
+
+            /**
+             * \brief Tells whether the kernels apply to the integer type T1
+             */
+            template <class T1>
+            struct Enabled
+            {
+                static const bool value = std::is_integral<T1>::value && std::is_signed<T1>::value && sizeof(T1) == 4;
+            };
+        }
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void FractionArray<T1, T2, Policy>::settle()
+    {
+        if constexpr (!Policy::reduction::lazy)
+            this->reduce();
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy>::FractionArray()
+    {
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy>::FractionArray(std::size_t size)
+        : numerators(size, T1(0)), denominators(size, T1(1))
+    {
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy>::FractionArray(std::initializer_list<Fraction<T1, T2, Policy>> fractions)
+        : FractionArray(fractions.begin(), fractions.end())
+    {
+    }
+
+
+    template <class T1, class T2, class Policy>
+    template <class Iterator>
+    FractionArray<T1, T2, Policy>::FractionArray(Iterator first, Iterator last)
+    {
+        for (; first != last; ++first)
+            this->push_back(*first);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::size_t FractionArray<T1, T2, Policy>::size() const
+    {
+        return numerators.size();
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void FractionArray<T1, T2, Policy>::resize(std::size_t size)
+    {
+        numerators.resize(size, T1(0));
+        denominators.resize(size, T1(1));
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void FractionArray<T1, T2, Policy>::reserve(std::size_t capacity)
+    {
+        numerators.reserve(capacity);
+        denominators.reserve(capacity);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void FractionArray<T1, T2, Policy>::push_back(const Fraction<T1, T2, Policy> &frac)
+    {
+        numerators.push_back(frac.getNum());
+        denominators.push_back(frac.getDenom());
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Fraction<T1, T2, Policy> FractionArray<T1, T2, Policy>::operator[](std::size_t i) const
+    {
+        if constexpr (Policy::reduction::lazy)
+            return Fraction<T1, T2, Policy>(numerators[i], denominators[i]);
+        else
+            return Fraction<T1, T2, Policy>(numerators[i], denominators[i], irreducible);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void FractionArray<T1, T2, Policy>::set(std::size_t i, const Fraction<T1, T2, Policy> &frac)
+    {
+        numerators[i] = frac.getNum();
+        denominators[i] = frac.getDenom();
+    }
+
+
+    template <class T1, class T2, class Policy>
+    const T1 *FractionArray<T1, T2, Policy>::numData() const
+    {
+        return numerators.data();
+    }
+
+
+    template <class T1, class T2, class Policy>
+    const T1 *FractionArray<T1, T2, Policy>::denomData() const
+    {
+        return denominators.data();
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void FractionArray<T1, T2, Policy>::reduce()
+    {
+        T1 *num = numerators.data(), *denom = denominators.data();
+        std::size_t n = this->size(), i = 0;
+
+        if constexpr (detail::simd::Enabled<T1>::value)
+            i = detail::simd::reduce((int32_t *) num, (int32_t *) denom, n);
+
+        for (; i < n; i++)
+        {
+            T1 g = Policy::gcd::compute(num[i], denom[i]);
+            if (g > 1) {
+                num[i] /= g;
+                denom[i] /= g;
+            }
+        }
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void FractionArray<T1, T2, Policy>::evaluate(T2 *values) const
+    {
+        const T1 *num = numerators.data(), *denom = denominators.data();
+        std::size_t n = this->size(), i = 0;
+
+        while (i < n)
+        {
+            if constexpr (detail::simd::Enabled<T1>::value && (std::is_same<T2, float>::value || std::is_same<T2, double>::value))
+                i += detail::simd::evaluate((const int32_t *) num + i, (const int32_t *) denom + i, values + i, n - i);
+
+            // The kernels stop at the tail, or at a block they cannot round correctly
+            for (std::size_t end = std::min(n, i + 16); i < end; i++)
+                values[i] = detail::quotient<T2>(num[i], denom[i]);
+        }
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::vector<T2> FractionArray<T1, T2, Policy>::evaluate() const
+    {
+        std::vector<T2> values(this->size());
+        this->evaluate(values.data());
+        return values;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    template <class Lane, class Scalar>
+    void FractionArray<T1, T2, Policy>::apply(Lane lane, Scalar scalar)
+    {
+        T1 *num = numerators.data(), *denom = denominators.data();
+        std::vector<std::size_t> overflowed;
+
+        for (std::size_t i = 0, n = this->size(); i < n; i++)
+        {
+            T1 a = num[i], b = denom[i];
+            bool overflow = false;
+            lane(a, b, i, overflow);
+
+            if (overflow)
+                overflowed.push_back(i);
+            else {
+                num[i] = a;
+                denom[i] = b;
+            }
+        }
+
+        this->settle();
+
+        // Elements left untouched by the loop, irreducible for an eager policy
+        for (std::size_t i : overflowed)
+        {
+            Fraction<T1, T2, Policy> frac = (*this)[i];
+            scalar(frac, i);
+            this->set(i, frac);
+        }
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy> &FractionArray<T1, T2, Policy>::operator+=(const FractionArray<T1, T2, Policy> &other)
+    {
+        typedef CheckedArithmetic<> C;
+        assertm(this->size() == other.size(), "Arrays should have the same size");
+
+        const T1 *a = other.numerators.data(), *b = other.denominators.data();
+        this->apply([a, b](T1 &n, T1 &d, std::size_t i, bool &overflow)
+        {
+            n = C::add(C::mul(n, b[i], overflow), C::mul(d, a[i], overflow), overflow);
+            d = C::mul(d, b[i], overflow);
+        }, [&other](Fraction<T1, T2, Policy> &frac, std::size_t i) { frac += other[i]; });
+
+        return *this;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy> &FractionArray<T1, T2, Policy>::operator-=(const FractionArray<T1, T2, Policy> &other)
+    {
+        typedef CheckedArithmetic<> C;
+        assertm(this->size() == other.size(), "Arrays should have the same size");
+
+        const T1 *a = other.numerators.data(), *b = other.denominators.data();
+        this->apply([a, b](T1 &n, T1 &d, std::size_t i, bool &overflow)
+        {
+            n = C::sub(C::mul(n, b[i], overflow), C::mul(d, a[i], overflow), overflow);
+            d = C::mul(d, b[i], overflow);
+        }, [&other](Fraction<T1, T2, Policy> &frac, std::size_t i) { frac -= other[i]; });
+
+        return *this;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy> &FractionArray<T1, T2, Policy>::operator*=(const FractionArray<T1, T2, Policy> &other)
+    {
+        typedef CheckedArithmetic<> C;
+        assertm(this->size() == other.size(), "Arrays should have the same size");
+
+        const T1 *a = other.numerators.data(), *b = other.denominators.data();
+        this->apply([a, b](T1 &n, T1 &d, std::size_t i, bool &overflow)
+        {
+            n = C::mul(n, a[i], overflow);
+            d = C::mul(d, b[i], overflow);
+        }, [&other](Fraction<T1, T2, Policy> &frac, std::size_t i) { frac *= other[i]; });
+
+        return *this;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy> &FractionArray<T1, T2, Policy>::operator/=(const FractionArray<T1, T2, Policy> &other)
+    {
+        typedef CheckedArithmetic<> C;
+        assertm(this->size() == other.size(), "Arrays should have the same size");
+
+        const T1 *a = other.numerators.data(), *b = other.denominators.data();
+        this->apply([a, b](T1 &n, T1 &d, std::size_t i, bool &overflow)
+        {
+            assertm(a[i] != 0, "Error: division by zero");
+
+            // Multiplication by the inverse, whose sign is carried by the numerator
+            const bool negative = a[i] < 0;
+            n = C::mul(n, negative ? C::sub(T1(0), b[i], overflow) : b[i], overflow);
+            d = C::mul(d, negative ? C::sub(T1(0), a[i], overflow) : a[i], overflow);
+        }, [&other](Fraction<T1, T2, Policy> &frac, std::size_t i) { frac /= other[i]; });
+
+        return *this;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy> &FractionArray<T1, T2, Policy>::operator+=(const Fraction<T1, T2, Policy> &frac)
+    {
+        typedef CheckedArithmetic<> C;
+        const T1 a = frac.getNum(), b = frac.getDenom();
+
+        this->apply([a, b](T1 &n, T1 &d, std::size_t, bool &overflow)
+        {
+            n = C::add(C::mul(n, b, overflow), C::mul(d, a, overflow), overflow);
+            d = C::mul(d, b, overflow);
+        }, [&frac](Fraction<T1, T2, Policy> &f, std::size_t) { f += frac; });
+
+        return *this;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy> &FractionArray<T1, T2, Policy>::operator-=(const Fraction<T1, T2, Policy> &frac)
+    {
+        typedef CheckedArithmetic<> C;
+        const T1 a = frac.getNum(), b = frac.getDenom();
+
+        this->apply([a, b](T1 &n, T1 &d, std::size_t, bool &overflow)
+        {
+            n = C::sub(C::mul(n, b, overflow), C::mul(d, a, overflow), overflow);
+            d = C::mul(d, b, overflow);
+        }, [&frac](Fraction<T1, T2, Policy> &f, std::size_t) { f -= frac; });
+
+        return *this;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy> &FractionArray<T1, T2, Policy>::operator*=(const Fraction<T1, T2, Policy> &frac)
+    {
+        typedef CheckedArithmetic<> C;
+        const T1 a = frac.getNum(), b = frac.getDenom();
+
+        this->apply([a, b](T1 &n, T1 &d, std::size_t, bool &overflow)
+        {
+            n = C::mul(n, a, overflow);
+            d = C::mul(d, b, overflow);
+        }, [&frac](Fraction<T1, T2, Policy> &f, std::size_t) { f *= frac; });
+
+        return *this;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy> &FractionArray<T1, T2, Policy>::operator/=(const Fraction<T1, T2, Policy> &frac)
+    {
+        typedef CheckedArithmetic<> C;
+        assertm(frac.getNum() != 0, "Error: division by zero");
+
+        // Multiplication by the inverse, whose sign is carried by the numerator;
+        // the opposite of the most negative numerator overflows every element
+        bool inverted = false;
+        T1 a = frac.getDenom(), b = frac.getNum();
+        if (b < 0)
+        {
+            a = C::sub(T1(0), a, inverted);
+            b = C::sub(T1(0), b, inverted);
+        }
+
+        this->apply([a, b, inverted](T1 &n, T1 &d, std::size_t, bool &overflow)
+        {
+            overflow = inverted;
+            n = C::mul(n, a, overflow);
+            d = C::mul(d, b, overflow);
+        }, [&frac](Fraction<T1, T2, Policy> &f, std::size_t) { f /= frac; });
+
+        return *this;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy> FractionArray<T1, T2, Policy>::operator+(const FractionArray<T1, T2, Policy> &other) const
+    {
+        FractionArray tmp(*this);
+        return tmp += other;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy> FractionArray<T1, T2, Policy>::operator-(const FractionArray<T1, T2, Policy> &other) const
+    {
+        FractionArray tmp(*this);
+        return tmp -= other;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy> FractionArray<T1, T2, Policy>::operator*(const FractionArray<T1, T2, Policy> &other) const
+    {
+        FractionArray tmp(*this);
+        return tmp *= other;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    FractionArray<T1, T2, Policy> FractionArray<T1, T2, Policy>::operator/(const FractionArray<T1, T2, Policy> &other) const
+    {
+        FractionArray tmp(*this);
+        return tmp /= other;
+    }
+}
+
+
+#endif  /*_FRACTION_ARRAY_H_*/
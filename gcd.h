@@ -0,0 +1,348 @@
+#ifndef _GCD_H_
+#define _GCD_H_
+
+/**
+ * \file gcd.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Greatest common divisor engines used to reduce fractions
+ */
+
+#include <climits>
+#include <cstdint>
+#include <type_traits>
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /**
+     * \namespace frac::detail
+     * \brief Implementation details, not part of the public interface
+     */
+    namespace detail
+    {
+        /**
+         * \brief Unsigned counterpart of an integer type, including 128-bit integers
+         *
+         * std::make_unsigned does not know about __int128 in strict ISO mode.
+         */
+        template <class T, class Enable = void>
+        struct Unsigned
+        {
+            typedef T type;
+        };
+
+        template <class T>
+        struct Unsigned<T, typename std::enable_if<std::is_integral<T>::value>::type>
+        {
+            typedef typename std::make_unsigned<T>::type type;
+        };
+
+#ifdef __SIZEOF_INT128__
+        template <>
+        struct Unsigned<__int128, void>
+        {
+            typedef unsigned __int128 type;
+        };
+
+        template <>
+        struct Unsigned<unsigned __int128, void>
+        {
+            typedef unsigned __int128 type;
+        };
+#endif
+
+        /**
+         * \brief Tells whether T is a builtin integer type (128-bit integers included)
+         */
+        template <class T>
+        struct IsBuiltinInteger
+        {
+            static const bool value = std::is_integral<T>::value;
+        };
+
+#ifdef __SIZEOF_INT128__
+        template <>
+        struct IsBuiltinInteger<__int128>
+        {
+            static const bool value = true;
+        };
+
+        template <>
+        struct IsBuiltinInteger<unsigned __int128>
+        {
+            static const bool value = true;
+        };
+#endif
+
+        /**
+         * \brief Magnitude of a builtin integer as an unsigned value
+         * \param[in] a The integer
+         * \return |a|, exact even for the most negative value
+         */
+        template <class T>
+        constexpr typename Unsigned<T>::type magnitude(T a)
+        {
+            typedef typename Unsigned<T>::type U;
+            return a < 0 ? U(0) - U(a) : U(a);
+        }
+
+        /**
+         * \brief Number of trailing zero bits of a non zero unsigned integer
+         */
+        constexpr int ctz(unsigned int x) { return __builtin_ctz(x); }
+        constexpr int ctz(unsigned long x) { return __builtin_ctzl(x); }
+        constexpr int ctz(unsigned long long x) { return __builtin_ctzll(x); }
+        constexpr int ctz(unsigned short x) { return __builtin_ctz(x); }
+        constexpr int ctz(unsigned char x) { return __builtin_ctz(x); }
+
+        /**
+         * \brief Number of leading zero bits of a non zero unsigned integer
+         */
+        constexpr int clz(unsigned int x) { return __builtin_clz(x); }
+        constexpr int clz(unsigned long x) { return __builtin_clzl(x); }
+        constexpr int clz(unsigned long long x) { return __builtin_clzll(x); }
+
+#ifdef __SIZEOF_INT128__
+        constexpr int ctz(unsigned __int128 x)
+        {
+            unsigned long long lo = (unsigned long long) x;
+            return lo ? __builtin_ctzll(lo) : 64 + __builtin_ctzll((unsigned long long) (x >> 64));
+        }
+
+        constexpr int clz(unsigned __int128 x)
+        {
+            unsigned long long hi = (unsigned long long) (x >> 64);
+            return hi ? __builtin_clzll(hi) : 64 + __builtin_clzll((unsigned long long) x);
+        }
+#endif
+    }
+
+
+
+    /**
+     * \class EuclidGCD
+     * \brief Euclid's algorithm using the remainder of the division
+     *
+     * Works for any integer-like type providing %, comparison and copy,
+     * which makes it the fallback for user defined integer types.
+     */
+    struct EuclidGCD
+    {
+        /**
+         * \brief Greatest common divisor
+         * \param[in] a First integer
+         * \param[in] b Second integer
+         * \return gcd(|a|, |b|), with gcd(0, 0) = 0
+         */
+        template <class T>
+        static constexpr T compute(T a, T b);
+    };
+
+
+    /**
+     * \class BinaryGCD
+     * \brief Stein's binary algorithm using count trailing zeros
+     *
+     * Only shifts and subtractions, no division: the fastest choice for
+     * builtin integers up to the machine word.
+     */
+    struct BinaryGCD
+    {
+        /**
+         * \brief Greatest common divisor
+         * \param[in] a First builtin integer
+         * \param[in] b Second builtin integer
+         * \return gcd(|a|, |b|), with gcd(0, 0) = 0
+         */
+        template <class T>
+        static constexpr T compute(T a, T b);
+    };
+
+
+    /**
+     * \class LehmerGCD
+     * \brief Lehmer's algorithm for integers wider than the machine word
+     *
+     * Runs several Euclid steps on the leading half-width digits and applies
+     * them at once to the full values, so that most of the work is done in
+     * native arithmetic instead of wide divisions.
+     */
+    struct LehmerGCD
+    {
+        /**
+         * \brief Greatest common divisor
+         * \param[in] a First builtin integer
+         * \param[in] b Second builtin integer
+         * \return gcd(|a|, |b|), with gcd(0, 0) = 0
+         */
+        template <class T>
+        static constexpr T compute(T a, T b);
+    };
+
+
+    /**
+     * \class AutoGCD
+     * \brief Selects the best engine for the integer type
+     *
+     * BinaryGCD up to 64 bits, LehmerGCD for wider builtin integers and
+     * EuclidGCD for any other type.
+     */
+    struct AutoGCD
+    {
+        /**
+         * \brief Greatest common divisor
+         * \param[in] a First integer
+         * \param[in] b Second integer
+         * \return gcd(|a|, |b|), with gcd(0, 0) = 0
+         */
+        template <class T>
+        static constexpr T compute(T a, T b);
+    };
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    template <class T>
+    constexpr T EuclidGCD::compute(T a, T b)
+    {
+        if (a < 0) a = -a;
+        if (b < 0) b = -b;
+
+        while (b != 0)
+        {
+            T r = a % b;
+            a = b;
+            b = r;
+        }
+
+        return a;
+    }
+
+
+    template <class T>
+    constexpr T BinaryGCD::compute(T a, T b)
+    {
+        static_assert(detail::IsBuiltinInteger<T>::value, "BinaryGCD requires a builtin integer type");
+        typedef typename detail::Unsigned<T>::type U;
+
+        U u = detail::magnitude(a), v = detail::magnitude(b);
+
+        if (u == 0) return T(v);
+        if (v == 0) return T(u);
+
+        // Common power of two, then both odd
+        int shift = detail::ctz(U(u | v));
+        u >>= detail::ctz(u);
+
+        do {
+            v >>= detail::ctz(v);
+            if (u > v)
+            {
+                U t = u;
+                u = v;
+                v = t;
+            }
+            v -= u;
+        } while (v != 0);
+
+        return T(u << shift);
+    }
+
+
+    template <class T>
+    constexpr T LehmerGCD::compute(T a, T b)
+    {
+        static_assert(detail::IsBuiltinInteger<T>::value, "LehmerGCD requires a builtin integer type");
+        typedef typename detail::Unsigned<T>::type U;
+
+        // Up to 32 bits the binary algorithm is already optimal
+        if constexpr (sizeof(U) * CHAR_BIT <= 32)
+            return BinaryGCD::compute(a, b);
+        else {
+            // Leading digits keep two spare bits so that the cofactor
+            // updates below can never overflow the half-width signed type
+            const int width = sizeof(U) * CHAR_BIT;
+            typedef typename std::conditional<(width > 64), long long, int>::type S;
+            typedef typename std::conditional<(width > 64), unsigned long long, unsigned int>::type H;
+            const int digits = width / 2 - 2;
+
+            U u = detail::magnitude(a), v = detail::magnitude(b);
+            if (u < v)
+            {
+                U t = u;
+                u = v;
+                v = t;
+            }
+
+            while ((v >> digits) != 0)
+            {
+                int shift = width - detail::clz(u) - digits;
+                S uh = S(u >> shift), vh = S(v >> shift);
+                S A = 1, B = 0, C = 0, D = 1;
+
+                // Euclid on the leading digits while the quotient is certain
+                while (vh + C != 0 && vh + D != 0)
+                {
+                    S q = (uh + A) / (vh + C);
+                    if (q != (uh + B) / (vh + D))
+                        break;
+
+                    S t = A - q * C; A = C; C = t;
+                    t = B - q * D; B = D; D = t;
+                    t = uh - q * vh; uh = vh; vh = t;
+                }
+
+                if (B == 0)
+                {
+                    // No progress on the leading digits: full precision step
+                    U r = u % v;
+                    u = v;
+                    v = r;
+                } else {
+                    // Exact results are in range, so wrapping arithmetic is fine
+                    U nu = U(A) * u + U(B) * v;
+                    U nv = U(C) * u + U(D) * v;
+                    u = nu;
+                    v = nv;
+                }
+            }
+
+            if (v == 0)
+                return T(u);
+
+            // Both values fit in half a word from here on
+            H x = H(v), y = H(u % v);
+            while (y != 0)
+            {
+                H r = x % y;
+                x = y;
+                y = r;
+            }
+
+            return T(x);
+        }
+    }
+
+
+    template <class T>
+    constexpr T AutoGCD::compute(T a, T b)
+    {
+        if constexpr (!detail::IsBuiltinInteger<T>::value)
+            return EuclidGCD::compute(a, b);
+        else if constexpr (sizeof(T) > 8)
+            return LehmerGCD::compute(a, b);
+        else
+            return BinaryGCD::compute(a, b);
+    }
+}
+
+
+#endif  /*_GCD_H_*/
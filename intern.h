@@ -0,0 +1,244 @@
+#ifndef _INTERN_H_
+#define _INTERN_H_
+
+/**
+ * \file intern.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Interning of fractions into compact integer identifiers
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "fraction.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /**
+     * \class FractionInternTable
+     * \brief Open addressing table mapping distinct fractions to dense 32-bit identifiers
+     *
+     * Identifiers are given in order of first insertion, from 0, so that two
+     * interned fractions are equal if and only if their identifiers are.
+     * The canonical terms are stored once, in two arrays indexed by the
+     * identifier; the slots only hold identifiers and hash tags, probed
+     * linearly.
+     */
+    template <class T1, class T2, class Policy = DefaultPolicy>
+    class FractionInternTable
+    {
+    private:
+        std::vector<T1> numerators;         /*!< Numerators of the interned fractions, by identifier */
+        std::vector<T1> denominators;       /*!< Denominators of the interned fractions, by identifier */
+        std::vector<std::uint32_t> slots;   /*!< Identifier plus one of each slot, 0 if empty */
+        std::vector<std::uint32_t> tags;    /*!< High bits of the hash of each slot */
+        std::size_t mask;                   /*!< Number of slots minus one */
+
+        /**
+         * \brief Slot of a fraction, or the empty slot where it would go
+         * \param[in] num Canonical numerator
+         * \param[in] denom Canonical denominator
+         * \param[in] hash Hash of the fraction
+         * \return Index of the slot
+         */
+        std::size_t probe(const T1 &num, const T1 &denom, std::uint64_t hash) const;
+
+        /**
+         * \brief Reallocation of the slots
+         * \param[in] capacity New number of slots, a power of two
+         */
+        void rehash(std::size_t capacity);
+
+    public:
+        static const std::uint32_t npos = 0xFFFFFFFFu;     /*!< Identifier of the fractions not in the table */
+
+        /**
+         * \brief Default constructor, empty table
+         */
+        FractionInternTable();
+
+        /**
+         * \brief Number of distinct fractions
+         * \return The size of the table, which is also the next identifier
+         */
+        std::size_t size() const;
+
+        /**
+         * \brief Reservation of memory
+         * \param[in] count Number of distinct fractions to make room for
+         */
+        void reserve(std::size_t count);
+
+        /**
+         * \brief Removal of every fraction
+         */
+        void clear();
+
+        /**
+         * \brief Identifier of a fraction, inserted if needed
+         * \param[in] frac The fraction to be interned
+         * \return The identifier of frac
+         */
+        std::uint32_t intern(const Fraction<T1, T2, Policy> &frac);
+
+        /**
+         * \brief Identifier of a fraction, without insertion
+         * \param[in] frac The fraction to be looked for
+         * \return The identifier of frac, npos if it has not been interned
+         */
+        std::uint32_t find(const Fraction<T1, T2, Policy> &frac) const;
+
+        /**
+         * \brief Fraction of an identifier
+         * \param[in] id An identifier given by intern()
+         * \return The interned fraction
+         */
+        Fraction<T1, T2, Policy> operator[](std::uint32_t id) const;
+    };
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    template <class T1, class T2, class Policy>
+    FractionInternTable<T1, T2, Policy>::FractionInternTable()
+        : slots(16, 0u), tags(16, 0u), mask(15)
+    {
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::size_t FractionInternTable<T1, T2, Policy>::probe(const T1 &num, const T1 &denom, std::uint64_t hash) const
+    {
+        const std::uint32_t tag = std::uint32_t(hash >> 32);
+        std::size_t i = std::size_t(hash) & mask;
+
+        // The load factor stays below 1/2, there is always an empty slot
+        while (slots[i] != 0)
+        {
+            std::uint32_t id = slots[i] - 1;
+            if (tags[i] == tag && numerators[id] == num && denominators[id] == denom)
+                break;
+            i = (i + 1) & mask;
+        }
+
+        return i;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void FractionInternTable<T1, T2, Policy>::rehash(std::size_t capacity)
+    {
+        std::vector<std::uint32_t> oldSlots(capacity, 0u), oldTags(capacity, 0u);
+        oldSlots.swap(slots);
+        oldTags.swap(tags);
+        mask = capacity - 1;
+
+        for (std::size_t j = 0; j < oldSlots.size(); j++)
+        {
+            if (oldSlots[j] == 0)
+                continue;
+
+            std::uint32_t id = oldSlots[j] - 1;
+            std::size_t i = std::size_t(detail::mixHash(detail::hashOf(numerators[id]), detail::hashOf(denominators[id]))) & mask;
+            while (slots[i] != 0)
+                i = (i + 1) & mask;
+
+            slots[i] = oldSlots[j];
+            tags[i] = oldTags[j];
+        }
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::size_t FractionInternTable<T1, T2, Policy>::size() const
+    {
+        return numerators.size();
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void FractionInternTable<T1, T2, Policy>::reserve(std::size_t count)
+    {
+        numerators.reserve(count);
+        denominators.reserve(count);
+
+        std::size_t capacity = slots.size();
+        while (capacity < 2 * count)
+            capacity *= 2;
+        if (capacity != slots.size())
+            this->rehash(capacity);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void FractionInternTable<T1, T2, Policy>::clear()
+    {
+        numerators.clear();
+        denominators.clear();
+        std::fill(slots.begin(), slots.end(), 0u);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::uint32_t FractionInternTable<T1, T2, Policy>::intern(const Fraction<T1, T2, Policy> &frac)
+    {
+        const T1 num = frac.getNum(), denom = frac.getDenom();
+        const std::uint64_t hash = detail::mixHash(detail::hashOf(num), detail::hashOf(denom));
+
+        std::size_t i = this->probe(num, denom, hash);
+        if (slots[i] != 0)
+            return slots[i] - 1;
+
+        assertm(numerators.size() < npos, "Too many distinct fractions for 32-bit identifiers");
+
+        std::uint32_t id = std::uint32_t(numerators.size());
+        numerators.push_back(num);
+        denominators.push_back(denom);
+        slots[i] = id + 1;
+        tags[i] = std::uint32_t(hash >> 32);
+
+        if (2 * numerators.size() > slots.size())
+            this->rehash(2 * slots.size());
+
+        return id;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::uint32_t FractionInternTable<T1, T2, Policy>::find(const Fraction<T1, T2, Policy> &frac) const
+    {
+        const T1 num = frac.getNum(), denom = frac.getDenom();
+        const std::uint64_t hash = detail::mixHash(detail::hashOf(num), detail::hashOf(denom));
+
+        std::size_t i = this->probe(num, denom, hash);
+        return slots[i] != 0 ? slots[i] - 1 : npos;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Fraction<T1, T2, Policy> FractionInternTable<T1, T2, Policy>::operator[](std::uint32_t id) const
+    {
+        if constexpr (Policy::reduction::lazy)
+            return Fraction<T1, T2, Policy>(numerators[id], denominators[id]);
+        else
+            return Fraction<T1, T2, Policy>(numerators[id], denominators[id], irreducible);
+    }
+}
+
+
+#endif  /*_INTERN_H_*/
@@ -0,0 +1,147 @@
+#ifndef _MAPPED_H_
+#define _MAPPED_H_
+
+/**
+ * \file mapped.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Read-only memory mapping of files
+ */
+
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /**
+     * \class MappedFile
+     * \brief Whole file mapped in memory for reading, released on destruction
+     *
+     * Uses mmap on POSIX systems; elsewhere the file is read into a buffer.
+     */
+    class MappedFile
+    {
+    private:
+        const char *address;        /*!< First byte of the file, nullptr if empty */
+        std::size_t length;         /*!< Size of the file in bytes */
+        std::vector<char> buffer;   /*!< Contents of the file when it cannot be mapped */
+
+    public:
+        /**
+         * \brief Constructor, maps the file
+         * \param[in] path Path of the file
+         *
+         * Throws std::runtime_error if the file cannot be opened.
+         */
+        explicit MappedFile(const std::string &path);
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        /**
+         * \brief Destructor, unmaps the file
+         */
+        ~MappedFile();
+
+        /**
+         * \brief Contents getter
+         * \return Pointer to the first byte of the file
+         */
+        const char *data() const;
+
+        /**
+         * \brief Size getter
+         * \return Size of the file in bytes
+         */
+        std::size_t size() const;
+    };
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    inline MappedFile::MappedFile(const std::string &path)
+        : address(nullptr), length(0)
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+            throw std::runtime_error("frac::MappedFile: cannot open " + path);
+
+        struct stat info;
+        if (::fstat(fd, &info) != 0)
+        {
+            ::close(fd);
+            throw std::runtime_error("frac::MappedFile: cannot stat " + path);
+        }
+
+        length = std::size_t(info.st_size);
+        if (length > 0)
+        {
+            void *map = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (map == MAP_FAILED)
+                throw std::runtime_error("frac::MappedFile: cannot map " + path);
+
+            // Files are read front to back
+            ::madvise(map, length, MADV_SEQUENTIAL);
+            address = static_cast<const char *>(map);
+        } else
+            ::close(fd);
+#else
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            throw std::runtime_error("frac::MappedFile: cannot open " + path);
+
+        buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        length = buffer.size();
+        address = length > 0 ? buffer.data() : nullptr;
+#endif
+    }
+
+
+    inline MappedFile::~MappedFile()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if (address != nullptr)
+            ::munmap(const_cast<char *>(address), length);
+#endif
+    }
+
+
+    inline const char *MappedFile::data() const
+    {
+        return address;
+    }
+
+
+    inline std::size_t MappedFile::size() const
+    {
+        return length;
+    }
+}
+
+
+#endif  /*_MAPPED_H_*/
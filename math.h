@@ -12,6 +12,8 @@
 
 #include <iostream>
 #include <cmath>
+#include <cstddef>
+#include <utility>
 
 
 /**
@@ -20,51 +22,206 @@
  */
 namespace frac
 {
+    namespace detail
+    {
+        /**
+         * \brief Quotient rounded toward minus infinity
+         * \param[in] num Numerator
+         * \param[in] denom Positive denominator
+         * \return The biggest integer less than or equal to num / denom
+         */
+        template <class T1>
+        constexpr T1 floorDiv(const T1 &num, const T1 &denom)
+        {
+            T1 q = num / denom;
+            if (num % denom != 0 && num < 0)
+                q -= 1;
+            return q;
+        }
+
+
+        /**
+         * \brief Quotient rounded toward plus infinity
+         * \param[in] num Numerator
+         * \param[in] denom Positive denominator
+         * \return The smallest integer greater than or equal to num / denom
+         */
+        template <class T1>
+        constexpr T1 ceilDiv(const T1 &num, const T1 &denom)
+        {
+            T1 q = num / denom;
+            if (num % denom != 0 && num > 0)
+                q += 1;
+            return q;
+        }
+
+
+        /**
+         * \brief Quotient rounded to the nearest integer, halves toward plus infinity
+         * \param[in] num Numerator
+         * \param[in] denom Positive denominator
+         * \return The nearest integer to num / denom
+         */
+        template <class T1>
+        constexpr T1 roundDiv(const T1 &num, const T1 &denom)
+        {
+            T1 q = floorDiv(num, denom);
+
+            // Remainder of the floored division, 0 <= r < denom, without computing q * denom
+            T1 r = num % denom;
+            if (r < 0)
+                r += denom;
+
+            // 2 * r >= denom without overflow
+            if (r >= denom - r)
+                q += 1;
+            return q;
+        }
+    }
+
+
     /** 
-     * \fn T1 ceil(const frac::Fraction<T1, T2> &frac);
+     * \fn T1 ceil(const frac::Fraction<T1, T2, Policy> &frac);
      * \brief Ceil function extended to fractions
      * \param frac The fraction to find the ceil value of
      * \return The smallest integer greater than or equal to frac
      */
-    template <class T1, class T2>
-    T1 ceil(const frac::Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr T1 ceil(const frac::Fraction<T1, T2, Policy> &frac)
     {
-        T2 value = frac.evaluate();
-        return std::ceil(value);
+        return detail::ceilDiv(frac.getNum(), frac.getDenom());
     }
 
 
     /** 
-     * \fn T1 floor(const frac::Fraction<T1, T2> &frac);
+     * \fn T1 floor(const frac::Fraction<T1, T2, Policy> &frac);
      * \brief Floor function extended to fractions
      * \param frac The fraction to find the floor value of
      * \return The biggest integer less than or equal to frac
      */
-    template <class T1, class T2>
-    T1 floor(const frac::Fraction<T1, T2> &frac)
+    template <class T1, class T2, class Policy>
+    constexpr T1 floor(const frac::Fraction<T1, T2, Policy> &frac)
     {
-        T2 value = frac.evaluate();
-        return std::floor(value);
+        return detail::floorDiv(frac.getNum(), frac.getDenom());
     }
 
 
     /** 
-     * \fn T1 round(frac::Fraction<T1, T2> frac);
+     * \fn T1 round(const frac::Fraction<T1, T2, Policy> &frac);
      * \brief Round function extended to fractions
      * \param frac The fraction to round
-     * \return The nearest integer to frac
+     * \return The nearest integer to frac, halves being rounded up
+     */
+    template <class T1, class T2, class Policy>
+    constexpr T1 round(const frac::Fraction<T1, T2, Policy> &frac)
+    {
+        return detail::roundDiv(frac.getNum(), frac.getDenom());
+    }
+
+
+    /** 
+     * \fn T1 trunc(const frac::Fraction<T1, T2, Policy> &frac);
+     * \brief Trunc function extended to fractions
+     * \param frac The fraction to truncate
+     * \return The integer part of frac, rounded toward zero
+     */
+    template <class T1, class T2, class Policy>
+    constexpr T1 trunc(const frac::Fraction<T1, T2, Policy> &frac)
+    {
+        return frac.getNum() / frac.getDenom();
+    }
+
+
+    /** 
+     * \fn std::pair<T1, frac::Fraction<T1, T2, Policy>> divmod(const frac::Fraction<T1, T2, Policy> &a, const frac::Fraction<T1, T2, Policy> &b);
+     * \brief Floored division of fractions
+     * \param a The dividend
+     * \param b The non zero divisor
+     * \return The quotient floor(a / b) and the remainder a - b * floor(a / b), of the sign of b
+     */
+    template <class T1, class T2, class Policy>
+    constexpr std::pair<T1, frac::Fraction<T1, T2, Policy>> divmod(const frac::Fraction<T1, T2, Policy> &a, const frac::Fraction<T1, T2, Policy> &b)
+    {
+        T1 q = floor(a / b);
+        return std::pair<T1, frac::Fraction<T1, T2, Policy>>(q, a - b * q);
+    }
+
+
+    /** 
+     * \fn frac::Fraction<T1, T2, Policy> mod(const frac::Fraction<T1, T2, Policy> &a, const frac::Fraction<T1, T2, Policy> &b);
+     * \brief Modulo extended to fractions
+     * \param a The dividend
+     * \param b The non zero divisor
+     * \return The remainder a - b * floor(a / b), of the sign of b
+     */
+    template <class T1, class T2, class Policy>
+    constexpr frac::Fraction<T1, T2, Policy> mod(const frac::Fraction<T1, T2, Policy> &a, const frac::Fraction<T1, T2, Policy> &b)
+    {
+        return divmod(a, b).second;
+    }
+
+
+    /** 
+     * \fn void ceil(const T1 *num, const T1 *denom, T1 *out, std::size_t size);
+     * \brief Ceil function on an array of fractions, as stored by FractionArray
+     * \param num The numerators
+     * \param denom The positive denominators
+     * \param out The size ceil values
+     * \param size Number of fractions
+     */
+    template <class T1>
+    void ceil(const T1 *num, const T1 *denom, T1 *out, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; i++)
+            out[i] = detail::ceilDiv(num[i], denom[i]);
+    }
+
+
+    /** 
+     * \fn void floor(const T1 *num, const T1 *denom, T1 *out, std::size_t size);
+     * \brief Floor function on an array of fractions, as stored by FractionArray
+     * \param num The numerators
+     * \param denom The positive denominators
+     * \param out The size floor values
+     * \param size Number of fractions
+     */
+    template <class T1>
+    void floor(const T1 *num, const T1 *denom, T1 *out, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; i++)
+            out[i] = detail::floorDiv(num[i], denom[i]);
+    }
+
+
+    /** 
+     * \fn void round(const T1 *num, const T1 *denom, T1 *out, std::size_t size);
+     * \brief Round function on an array of fractions, as stored by FractionArray
+     * \param num The numerators
+     * \param denom The positive denominators
+     * \param out The size rounded values
+     * \param size Number of fractions
+     */
+    template <class T1>
+    void round(const T1 *num, const T1 *denom, T1 *out, std::size_t size)
+    {
+        for (std::size_t i = 0; i < size; i++)
+            out[i] = detail::roundDiv(num[i], denom[i]);
+    }
+
+
+    /** 
+     * \fn void trunc(const T1 *num, const T1 *denom, T1 *out, std::size_t size);
+     * \brief Trunc function on an array of fractions, as stored by FractionArray
+     * \param num The numerators
+     * \param denom The positive denominators
+     * \param out The size truncated values
+     * \param size Number of fractions
      */
-    template <class T1, class T2>
-    T1 round(frac::Fraction<T1, T2> frac)
+    template <class T1>
+    void trunc(const T1 *num, const T1 *denom, T1 *out, std::size_t size)
     {
-        T1 tmp = floor(frac);
-        frac::Fraction<T1, T2> diff = frac - tmp;
-        T2 value = diff.evaluate();
-
-        if (value < 0.5)
-            return tmp;
-        else
-            return ceil(frac);
+        for (std::size_t i = 0; i < size; i++)
+            out[i] = num[i] / denom[i];
     }
 }
 
@@ -0,0 +1,617 @@
+#ifndef _MATRIX_H_
+#define _MATRIX_H_
+
+/**
+ * \file matrix.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Dense matrices of fractions with exact fraction-free elimination
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "fraction.h"
+#include "algorithm.h"
+#include "bigint.h"
+#include "parallel.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /**
+     * \class Matrix
+     * \brief Dense matrix of fractions, stored row by row in one array
+     *
+     * Determinant, rank, solve() and inverse() scale each row by the common
+     * denominator of its entries and run the fraction-free elimination of
+     * Bareiss on the integer rows, in BigInt since the intermediate minors
+     * outgrow any builtin type. Every division of the elimination is exact,
+     * and the fractions of the result are reduced once at the end. The rows
+     * below (and above, for solve()) the pivot are updated in parallel on
+     * large matrices.
+     *
+     * A result whose reduced terms do not fit in T1 is reported to the
+     * overflow handler of checked policies, and approximated in T2.
+     */
+    template <class T1, class T2, class Policy = DefaultPolicy>
+    class Matrix
+    {
+    public:
+        typedef Fraction<T1, T2, Policy> value_type;    /*!< Type of the entries */
+
+    private:
+        std::size_t height;                 /*!< Number of rows */
+        std::size_t width;                  /*!< Number of columns */
+        std::vector<value_type> entries;    /*!< Entries, row after row */
+
+    public:
+        /**
+         * \brief Default constructor, empty matrix
+         */
+        Matrix();
+
+        /**
+         * \brief Constructor
+         * \param[in] rows Number of rows
+         * \param[in] cols Number of columns
+         *
+         * All the entries are zero.
+         */
+        Matrix(std::size_t rows, std::size_t cols);
+
+        /**
+         * \brief Constructor from a list of rows
+         * \param[in] rows The rows, all of the same size
+         */
+        Matrix(std::initializer_list<std::initializer_list<value_type>> rows);
+
+        /**
+         * \brief Identity matrix
+         * \param[in] size Number of rows and columns
+         * \return The identity matrix of the given size
+         */
+        static Matrix identity(std::size_t size);
+
+        /**
+         * \brief Number of rows
+         */
+        std::size_t rows() const;
+
+        /**
+         * \brief Number of columns
+         */
+        std::size_t cols() const;
+
+        /**
+         * \brief Entry access
+         * \param[in] i Row
+         * \param[in] j Column
+         * \return Reference to the entry
+         */
+        value_type &operator()(std::size_t i, std::size_t j);
+
+        /**
+         * \brief Entry access
+         * \param[in] i Row
+         * \param[in] j Column
+         * \return Reference to the entry
+         */
+        const value_type &operator()(std::size_t i, std::size_t j) const;
+
+        /**
+         * \brief Entries getter
+         * \return Pointer to the entries, row after row
+         */
+        const value_type *data() const;
+
+        /**
+         * \brief Transposition
+         * \return The transposed matrix
+         */
+        Matrix transpose() const;
+
+        /**
+         * \brief Sum of matrices of the same size
+         */
+        Matrix operator+(const Matrix &m) const;
+
+        /**
+         * \brief Difference of matrices of the same size
+         */
+        Matrix operator-(const Matrix &m) const;
+
+        /**
+         * \brief Product of matrices, each entry being an exact dot()
+         * \param[in] m Matrix with as many rows as this one has columns
+         * \return The product, computed in parallel by rows
+         */
+        Matrix operator*(const Matrix &m) const;
+
+        /**
+         * \brief Product with a vector
+         * \param[in] v Vector with as many entries as the matrix has columns
+         * \return The product
+         */
+        std::vector<value_type> operator*(const std::vector<value_type> &v) const;
+
+        bool operator==(const Matrix &m) const;
+        bool operator!=(const Matrix &m) const;
+
+        /**
+         * \brief Integer rows of the matrix next to the rows of another
+         * \param[in] rhs Matrix with as many rows, appended on the right, or nullptr
+         * \param[out] scale Product of the factors of the rows, if not nullptr
+         * \return The rows of [this | rhs], each one multiplied by the common
+         * denominator of its entries, row after row
+         *
+         * The systems solved by elimination have the same solutions.
+         */
+        std::vector<BigInt> scaledRows(const Matrix *rhs, BigInt *scale = nullptr) const;
+
+        /**
+         * \brief Determinant of a square matrix
+         * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+         * \return The exact determinant
+         */
+        value_type determinant(unsigned threads = 0) const;
+
+        /**
+         * \brief Rank
+         * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+         * \return The number of linearly independent rows
+         */
+        std::size_t rank(unsigned threads = 0) const;
+
+        /**
+         * \brief Solution of the system A X = B for a square invertible matrix A
+         * \param[in] b Right-hand sides, one per column, with as many rows as A
+         * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+         * \return The exact solution X
+         *
+         * Throws std::domain_error if the matrix is singular.
+         */
+        Matrix solve(const Matrix &b, unsigned threads = 0) const;
+
+        /**
+         * \brief Solution of the system A x = b for a square invertible matrix A
+         * \param[in] b Right-hand side, with as many entries as A has rows
+         * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+         * \return The exact solution x
+         *
+         * Throws std::domain_error if the matrix is singular.
+         */
+        std::vector<value_type> solve(const std::vector<value_type> &b, unsigned threads = 0) const;
+
+        /**
+         * \brief Inverse of a square invertible matrix
+         * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+         * \return The exact inverse
+         *
+         * Throws std::domain_error if the matrix is singular.
+         */
+        Matrix inverse(unsigned threads = 0) const;
+    };
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    namespace detail
+    {
+        /**
+         * \brief Minimal number of BigInt updates of an elimination step handled by a thread
+         */
+        const std::size_t eliminationGrain = std::size_t(1) << 14;
+
+
+        /**
+         * \brief Fraction-free elimination of Bareiss on integer rows
+         * \param[in,out] m The rows x cols integers, row after row
+         * \param[in] rows Number of rows
+         * \param[in] cols Number of columns
+         * \param[in] pivots Number of leading columns in which pivots are searched
+         * \param[in] jordan Whether the rows above the pivots are eliminated too
+         * \param[out] sign Sign of the permutation of the rows
+         * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+         * \return The rank of the leading columns
+         *
+         * Each step replaces m[i][j] by (p * m[i][j] - m[i][c] * m[r][j]) / q,
+         * where p = m[r][c] is the new pivot and q the previous one, 1 at
+         * first: the entries stay minors of the original rows, so that the
+         * division is exact. Once done, the last pivot is the determinant of
+         * the leading rank x rank block up to the sign; with jordan, it is
+         * also on the diagonal of every pivot row.
+         */
+        inline std::size_t bareiss(std::vector<BigInt> &m, std::size_t rows, std::size_t cols, std::size_t pivots,
+                                   bool jordan, int &sign, unsigned threads)
+        {
+            BigInt previous(1);
+            std::size_t r = 0;
+            sign = 1;
+
+            for (std::size_t c = 0; c < pivots && r < rows; c++)
+            {
+                std::size_t p = r;
+                while (p < rows && m[p * cols + c].sign() == 0)
+                    p++;
+                if (p == rows)
+                    continue;
+
+                if (p != r)
+                {
+                    std::swap_ranges(m.begin() + p * cols, m.begin() + (p + 1) * cols, m.begin() + r * cols);
+                    sign = -sign;
+                }
+
+                const BigInt pivot = m[r * cols + c];
+                const std::size_t first = jordan ? 0 : r + 1, count = rows - first - (jordan ? 1 : 0);
+                const unsigned chunks = threadCount(count * (cols - c), eliminationGrain, threads);
+
+                parallelFor(count, chunks, [&](unsigned, std::size_t begin, std::size_t end) {
+                    for (std::size_t k = begin; k < end; k++)
+                    {
+                        // Rows above the pivot row keep values in earlier columns
+                        const std::size_t i = first + k + (jordan && first + k >= r ? 1 : 0);
+                        BigInt *row = m.data() + i * cols;
+                        const BigInt *top = m.data() + r * cols;
+                        const BigInt factor = row[c];
+
+                        for (std::size_t j = i < r ? 0 : c + 1; j < cols; j++)
+                        {
+                            if (j == c)
+                                continue;
+                            if (factor.sign() == 0)
+                                row[j] = row[j] * pivot / previous;
+                            else
+                                row[j] = (pivot * row[j] - factor * top[j]) / previous;
+                        }
+                        row[c] = BigInt(0);
+                    }
+                });
+
+                previous = pivot;
+                r++;
+            }
+
+            return r;
+        }
+
+
+        /**
+         * \brief Fraction from the quotient of two BigInt
+         * \param[in] num Numerator
+         * \param[in] denom Denominator, not zero
+         * \return The reduced fraction, see Matrix for the values out of T1
+         */
+        template <class F>
+        F fromBigInts(BigInt num, BigInt denom)
+        {
+            typedef typename F::integer_type T1;
+            typedef typename F::floating_type T2;
+            typedef typename F::policy_type::arithmetic A;
+
+            if (denom.sign() < 0)
+            {
+                num = -num;
+                denom = -denom;
+            }
+
+            BigInt g = AutoGCD::compute(num, denom);
+            if (g != BigInt(1))
+            {
+                num /= g;
+                denom /= g;
+            }
+
+            T1 n(0), d(1);
+            if (fromBigInt(num, n) && fromBigInt(denom, d))
+                return F(n, d, irreducible);
+
+            if constexpr (A::checked)
+                A::handler::overflow();
+            return F(T2(num) / T2(denom));
+        }
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Matrix<T1, T2, Policy>::Matrix()
+        : height(0), width(0)
+    {
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Matrix<T1, T2, Policy>::Matrix(std::size_t rows, std::size_t cols)
+        : height(rows), width(cols), entries(rows * cols)
+    {
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Matrix<T1, T2, Policy>::Matrix(std::initializer_list<std::initializer_list<value_type>> rows)
+        : height(rows.size()), width(rows.size() > 0 ? rows.begin()->size() : 0)
+    {
+        entries.reserve(height * width);
+        for (const std::initializer_list<value_type> &row : rows)
+        {
+            assertm(row.size() == width, "Rows of a matrix should have the same size");
+            entries.insert(entries.end(), row.begin(), row.end());
+        }
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Matrix<T1, T2, Policy> Matrix<T1, T2, Policy>::identity(std::size_t size)
+    {
+        Matrix m(size, size);
+        for (std::size_t i = 0; i < size; i++)
+            m(i, i) = value_type(T1(1));
+
+        return m;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::size_t Matrix<T1, T2, Policy>::rows() const
+    {
+        return height;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::size_t Matrix<T1, T2, Policy>::cols() const
+    {
+        return width;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    typename Matrix<T1, T2, Policy>::value_type &Matrix<T1, T2, Policy>::operator()(std::size_t i, std::size_t j)
+    {
+        return entries[i * width + j];
+    }
+
+
+    template <class T1, class T2, class Policy>
+    const typename Matrix<T1, T2, Policy>::value_type &Matrix<T1, T2, Policy>::operator()(std::size_t i, std::size_t j) const
+    {
+        return entries[i * width + j];
+    }
+
+
+    template <class T1, class T2, class Policy>
+    const typename Matrix<T1, T2, Policy>::value_type *Matrix<T1, T2, Policy>::data() const
+    {
+        return entries.data();
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Matrix<T1, T2, Policy> Matrix<T1, T2, Policy>::transpose() const
+    {
+        Matrix t(width, height);
+
+        // By tiles, so that both matrices are walked within a few cache lines
+        const std::size_t tile = 32;
+        for (std::size_t i0 = 0; i0 < height; i0 += tile)
+        {
+            for (std::size_t j0 = 0; j0 < width; j0 += tile)
+            {
+                for (std::size_t i = i0; i < std::min(i0 + tile, height); i++)
+                {
+                    for (std::size_t j = j0; j < std::min(j0 + tile, width); j++)
+                        t.entries[j * height + i] = entries[i * width + j];
+                }
+            }
+        }
+
+        return t;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Matrix<T1, T2, Policy> Matrix<T1, T2, Policy>::operator+(const Matrix &m) const
+    {
+        assertm(height == m.height && width == m.width, "Matrices should have the same size");
+
+        Matrix s(height, width);
+        for (std::size_t k = 0; k < entries.size(); k++)
+            s.entries[k] = entries[k] + m.entries[k];
+
+        return s;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Matrix<T1, T2, Policy> Matrix<T1, T2, Policy>::operator-(const Matrix &m) const
+    {
+        assertm(height == m.height && width == m.width, "Matrices should have the same size");
+
+        Matrix s(height, width);
+        for (std::size_t k = 0; k < entries.size(); k++)
+            s.entries[k] = entries[k] - m.entries[k];
+
+        return s;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Matrix<T1, T2, Policy> Matrix<T1, T2, Policy>::operator*(const Matrix &m) const
+    {
+        assertm(width == m.height, "Matrices should have compatible sizes");
+
+        // Columns of m made contiguous, each entry is the dot product of two arrays
+        const Matrix t = m.transpose();
+        Matrix p(height, m.width);
+
+        unsigned chunks = detail::threadCount(height * m.width * width, detail::fractionGrain);
+        detail::parallelFor(height, chunks, [&](unsigned, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                const value_type *row = entries.data() + i * width;
+                for (std::size_t j = 0; j < m.width; j++)
+                    p.entries[i * m.width + j] = detail::dotRange(row, row + width, t.entries.data() + j * width);
+            }
+        });
+
+        return p;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::vector<typename Matrix<T1, T2, Policy>::value_type> Matrix<T1, T2, Policy>::operator*(const std::vector<value_type> &v) const
+    {
+        assertm(width == v.size(), "The vector should have as many entries as the matrix has columns");
+
+        std::vector<value_type> p(height);
+        for (std::size_t i = 0; i < height; i++)
+            p[i] = detail::dotRange(entries.data() + i * width, entries.data() + (i + 1) * width, v.data());
+
+        return p;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    bool Matrix<T1, T2, Policy>::operator==(const Matrix &m) const
+    {
+        return height == m.height && width == m.width && entries == m.entries;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    bool Matrix<T1, T2, Policy>::operator!=(const Matrix &m) const
+    {
+        return !(*this == m);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::vector<BigInt> Matrix<T1, T2, Policy>::scaledRows(const Matrix *rhs, BigInt *scale) const
+    {
+        const std::size_t extra = rhs != nullptr ? rhs->width : 0, cols = width + extra;
+        std::vector<BigInt> m(height * cols);
+
+        for (std::size_t i = 0; i < height; i++)
+        {
+            auto entry = [&](std::size_t j) -> const value_type & {
+                return j < width ? entries[i * width + j] : rhs->entries[i * extra + j - width];
+            };
+
+            // Least common multiple of the denominators of the row
+            BigInt factor(1);
+            for (std::size_t j = 0; j < cols; j++)
+            {
+                BigInt denom = detail::toBigInt(entry(j).getDenom());
+                if (denom != BigInt(1))
+                    factor = factor / AutoGCD::compute(factor, denom) * denom;
+            }
+
+            for (std::size_t j = 0; j < cols; j++)
+            {
+                const value_type &e = entry(j);
+                m[i * cols + j] = detail::toBigInt(e.getNum()) * (factor / detail::toBigInt(e.getDenom()));
+            }
+
+            if (scale != nullptr)
+                *scale *= factor;
+        }
+
+        return m;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    typename Matrix<T1, T2, Policy>::value_type Matrix<T1, T2, Policy>::determinant(unsigned threads) const
+    {
+        assertm(height == width, "The determinant needs a square matrix");
+
+        // Each row is multiplied by the common denominator of its entries
+        BigInt scale(1);
+        std::vector<BigInt> m = this->scaledRows(nullptr, &scale);
+        int sign = 1;
+        if (detail::bareiss(m, height, width, width, false, sign, threads) < height)
+            return value_type();
+        if (height == 0)
+            return value_type(T1(1));
+
+        BigInt det = m[height * width - 1];
+        return detail::fromBigInts<value_type>(sign < 0 ? -det : det, scale);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::size_t Matrix<T1, T2, Policy>::rank(unsigned threads) const
+    {
+        std::vector<BigInt> m = this->scaledRows(nullptr);
+        int sign = 1;
+
+        return detail::bareiss(m, height, width, width, false, sign, threads);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Matrix<T1, T2, Policy> Matrix<T1, T2, Policy>::solve(const Matrix &b, unsigned threads) const
+    {
+        assertm(height == width, "The system should be square");
+        assertm(b.height == height, "The right-hand sides should have as many rows as the system");
+
+        const std::size_t cols = width + b.width;
+        std::vector<BigInt> m = this->scaledRows(&b);
+        int sign = 1;
+        if (detail::bareiss(m, height, cols, width, true, sign, threads) < height)
+            throw std::domain_error("frac::Matrix: singular matrix");
+
+        // Every diagonal entry is the last pivot d, and row i reads d x[i] = m[i][n + j]
+        Matrix x(height, b.width);
+        if (height == 0)
+            return x;
+
+        const BigInt &denom = m[(height - 1) * cols + height - 1];
+        unsigned chunks = detail::threadCount(height * b.width, detail::fractionGrain, threads);
+        detail::parallelFor(height, chunks, [&](unsigned, std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; i++)
+            {
+                for (std::size_t j = 0; j < b.width; j++)
+                    x.entries[i * b.width + j] = detail::fromBigInts<value_type>(m[i * cols + width + j], denom);
+            }
+        });
+
+        return x;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::vector<typename Matrix<T1, T2, Policy>::value_type> Matrix<T1, T2, Policy>::solve(const std::vector<value_type> &b, unsigned threads) const
+    {
+        Matrix column(b.size(), 1);
+        column.entries = b;
+
+        return this->solve(column, threads).entries;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Matrix<T1, T2, Policy> Matrix<T1, T2, Policy>::inverse(unsigned threads) const
+    {
+        return this->solve(Matrix::identity(height), threads);
+    }
+}
+
+
+#endif  /*_MATRIX_H_*/
@@ -0,0 +1,708 @@
+#ifndef _MODULAR_H_
+#define _MODULAR_H_
+
+/**
+ * \file modular.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Multi-modular exact linear algebra: images modulo word-size primes, CRT and rational reconstruction
+ */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "fraction.h"
+#include "bigint.h"
+#include "matrix.h"
+#include "parallel.h"
+
+#ifndef __SIZEOF_INT128__
+#error "modular.h needs 128-bit integers for the Montgomery products"
+#endif
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /**
+     * \brief Determinant of a square matrix by multi-modular computation
+     * \param[in] a The matrix
+     * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+     * \return The exact determinant, as Matrix::determinant()
+     *
+     * The determinant of the integer rows (see Matrix::scaledRows()) is
+     * computed modulo as many 62-bit primes as needed to exceed twice its
+     * Hadamard bound, one prime per thread, then recovered by CRT.
+     */
+    template <class T1, class T2, class Policy>
+    Fraction<T1, T2, Policy> determinantModular(const Matrix<T1, T2, Policy> &a, unsigned threads = 0);
+
+    /**
+     * \brief Solution of A X = B by multi-modular computation
+     * \param[in] a Square invertible matrix A
+     * \param[in] b Right-hand sides B, one per column
+     * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+     * \return The exact solution X, as Matrix::solve()
+     *
+     * The integer system is solved modulo 62-bit primes, one per thread,
+     * with Montgomery arithmetic; the images are combined by CRT, and after
+     * each round of primes the fractions are recovered by rational
+     * reconstruction. The computation stops as soon as the reconstructed
+     * solution satisfies the system exactly, usually long before the
+     * worst-case bound on the number of primes. Throws std::domain_error if
+     * A is singular.
+     */
+    template <class T1, class T2, class Policy>
+    Matrix<T1, T2, Policy> solveModular(const Matrix<T1, T2, Policy> &a, const Matrix<T1, T2, Policy> &b, unsigned threads = 0);
+
+    /**
+     * \brief Solution of A x = b by multi-modular computation, see solveModular()
+     */
+    template <class T1, class T2, class Policy>
+    std::vector<Fraction<T1, T2, Policy>> solveModular(const Matrix<T1, T2, Policy> &a, const std::vector<Fraction<T1, T2, Policy>> &b,
+                                                       unsigned threads = 0);
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    namespace detail
+    {
+        /**
+         * \class Montgomery
+         * \brief Arithmetic modulo an odd prime below 2^62 in Montgomery form
+         *
+         * Residues are stored as a * 2^64 mod p, so that a product is reduced
+         * by two multiplications and a shift instead of a division.
+         */
+        class Montgomery
+        {
+        private:
+            std::uint64_t modulus;      /*!< The prime p */
+            std::uint64_t negInverse;   /*!< -1/p modulo 2^64 */
+            std::uint64_t r2;           /*!< 2^128 modulo p */
+
+        public:
+            /**
+             * \brief Constructor
+             * \param[in] p An odd prime below 2^62
+             */
+            explicit Montgomery(std::uint64_t p)
+                : modulus(p), negInverse(0), r2(0)
+            {
+                // Newton iteration, each step doubles the number of correct low bits
+                std::uint64_t inverse = p;
+                for (int i = 0; i < 5; i++)
+                    inverse *= 2 - p * inverse;
+                negInverse = std::uint64_t(0) - inverse;
+
+                unsigned __int128 r = ((unsigned __int128) 1 << 64) % p;
+                r2 = std::uint64_t(r * r % p);
+            }
+
+            std::uint64_t prime() const
+            {
+                return modulus;
+            }
+
+            /**
+             * \brief Montgomery reduction
+             * \param[in] t A value below p * 2^64
+             * \return t / 2^64 modulo p
+             */
+            std::uint64_t reduce(unsigned __int128 t) const
+            {
+                std::uint64_t m = std::uint64_t(t) * negInverse;
+                std::uint64_t u = std::uint64_t((t + (unsigned __int128) m * modulus) >> 64);
+                return u >= modulus ? u - modulus : u;
+            }
+
+            std::uint64_t multiply(std::uint64_t a, std::uint64_t b) const
+            {
+                return this->reduce((unsigned __int128) a * b);
+            }
+
+            std::uint64_t add(std::uint64_t a, std::uint64_t b) const
+            {
+                std::uint64_t s = a + b;
+                return s >= modulus ? s - modulus : s;
+            }
+
+            std::uint64_t sub(std::uint64_t a, std::uint64_t b) const
+            {
+                return a >= b ? a - b : a + modulus - b;
+            }
+
+            /**
+             * \brief Conversion of a residue to Montgomery form
+             */
+            std::uint64_t to(std::uint64_t a) const
+            {
+                return this->multiply(a, r2);
+            }
+
+            /**
+             * \brief Conversion of a residue from Montgomery form
+             */
+            std::uint64_t from(std::uint64_t a) const
+            {
+                return this->reduce(a);
+            }
+
+            /**
+             * \brief Inverse of a non zero residue, by Fermat's little theorem
+             */
+            std::uint64_t inverse(std::uint64_t a) const
+            {
+                std::uint64_t result = this->to(1), e = modulus - 2;
+                for (; e > 0; e >>= 1)
+                {
+                    if (e & 1)
+                        result = this->multiply(result, a);
+                    a = this->multiply(a, a);
+                }
+
+                return result;
+            }
+        };
+
+
+        /**
+         * \brief Deterministic Miller-Rabin test for 64-bit integers
+         */
+        inline bool isPrime(std::uint64_t n)
+        {
+            if (n < 2)
+                return false;
+            for (std::uint64_t p : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+            {
+                if (n % p == 0)
+                    return n == p;
+            }
+
+            std::uint64_t d = n - 1;
+            unsigned int s = 0;
+            for (; (d & 1) == 0; s++)
+                d >>= 1;
+
+            auto mulmod = [n](std::uint64_t a, std::uint64_t b) { return std::uint64_t((unsigned __int128) a * b % n); };
+            for (std::uint64_t a : {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37})
+            {
+                std::uint64_t x = 1, base = a;
+                for (std::uint64_t e = d; e > 0; e >>= 1)
+                {
+                    if (e & 1)
+                        x = mulmod(x, base);
+                    base = mulmod(base, base);
+                }
+
+                if (x == 1 || x == n - 1)
+                    continue;
+
+                bool witness = true;
+                for (unsigned int i = 1; i < s && witness; i++)
+                {
+                    x = mulmod(x, x);
+                    witness = x != n - 1;
+                }
+                if (witness)
+                    return false;
+            }
+
+            return true;
+        }
+
+
+        /**
+         * \brief Next prime of a decreasing sequence below 2^62
+         * \param[in,out] candidate Odd number below which the prime is searched, then the prime minus 2
+         * \return The prime
+         */
+        inline std::uint64_t nextPrime(std::uint64_t &candidate)
+        {
+            while (!isPrime(candidate))
+                candidate -= 2;
+
+            std::uint64_t p = candidate;
+            candidate -= 2;
+            return p;
+        }
+
+
+        /**
+         * \struct Words
+         * \brief Integer split in 62-bit words, to compute its residues without BigInt divisions
+         */
+        struct Words
+        {
+            bool negative;                      /*!< Sign of the integer */
+            std::vector<std::uint64_t> words;   /*!< Words of the magnitude, most significant first */
+        };
+
+
+        /**
+         * \brief Splitting of a BigInt in 62-bit words
+         */
+        inline Words split(const BigInt &value)
+        {
+            Words result{value.sign() < 0, {}};
+            BigInt rest = result.negative ? -value : value;
+            while (!rest.isSmall())
+            {
+                BigInt high = rest >> 62;
+                result.words.push_back(std::uint64_t((rest - (high << 62)).toInt64()));
+                rest = std::move(high);
+            }
+
+            result.words.push_back(std::uint64_t(rest.toInt64()));
+            std::reverse(result.words.begin(), result.words.end());
+            return result;
+        }
+
+
+        /**
+         * \brief Residue of a split integer modulo a word-size prime
+         */
+        inline std::uint64_t residue(const Words &value, std::uint64_t p)
+        {
+            unsigned __int128 r = 0;
+            for (std::uint64_t word : value.words)
+                r = ((r << 62) + word) % p;
+
+            return value.negative && r != 0 ? p - std::uint64_t(r) : std::uint64_t(r);
+        }
+
+
+        /**
+         * \brief Gauss-Jordan elimination modulo a prime
+         * \param[in] m The rows x cols integers, row after row
+         * \param[in] rows Number of rows, and of pivot columns
+         * \param[in] cols Number of columns
+         * \param[in] field Arithmetic modulo the prime
+         * \param[out] out Residues of the last cols - rows columns of the solution, row after row
+         * \param[out] det Residue of the determinant of the leading block
+         * \return False if the leading block is singular modulo the prime
+         *
+         * With cols == rows, only the determinant is computed, by forward elimination.
+         */
+        inline bool eliminateModular(const std::vector<Words> &m, std::size_t rows, std::size_t cols, const Montgomery &field,
+                                     std::uint64_t *out, std::uint64_t &det)
+        {
+            const std::uint64_t p = field.prime();
+            std::vector<std::uint64_t> a(m.size());
+            for (std::size_t k = 0; k < m.size(); k++)
+                a[k] = field.to(residue(m[k], p));
+
+            const bool jordan = cols > rows;
+            std::uint64_t d = field.to(1);
+            for (std::size_t c = 0; c < rows; c++)
+            {
+                std::size_t r = c;
+                while (r < rows && a[r * cols + c] == 0)
+                    r++;
+                if (r == rows)
+                {
+                    det = 0;
+                    return false;
+                }
+
+                if (r != c)
+                {
+                    std::swap_ranges(a.begin() + r * cols, a.begin() + (r + 1) * cols, a.begin() + c * cols);
+                    d = field.sub(0, d);
+                }
+
+                std::uint64_t *top = a.data() + c * cols;
+                const std::uint64_t inverse = field.inverse(top[c]);
+                d = field.multiply(d, top[c]);
+
+                // Pivot row scaled to 1 for the solution, left as is for the determinant
+                if (jordan)
+                {
+                    for (std::size_t j = c; j < cols; j++)
+                        top[j] = field.multiply(top[j], inverse);
+                }
+
+                for (std::size_t i = jordan ? 0 : c + 1; i < rows; i++)
+                {
+                    std::uint64_t *row = a.data() + i * cols;
+                    if (i == c || row[c] == 0)
+                        continue;
+
+                    const std::uint64_t factor = jordan ? row[c] : field.multiply(row[c], inverse);
+                    for (std::size_t j = c; j < cols; j++)
+                        row[j] = field.sub(row[j], field.multiply(factor, top[j]));
+                }
+            }
+
+            det = field.from(d);
+            if (jordan)
+            {
+                const std::size_t extra = cols - rows;
+                for (std::size_t i = 0; i < rows; i++)
+                {
+                    for (std::size_t j = 0; j < extra; j++)
+                        out[i * extra + j] = field.from(a[i * cols + rows + j]);
+                }
+            }
+
+            return true;
+        }
+
+
+        /**
+         * \class MixedRadix
+         * \brief Chinese remaindering of several values, in Garner's mixed radix representation
+         *
+         * Each value is kept as digits x = d0 + d1 p0 + d2 p0 p1 + ..., so that
+         * adding a prime only needs word operations modulo that prime; the
+         * BigInt values are built on demand.
+         */
+        class MixedRadix
+        {
+        private:
+            std::size_t count;                  /*!< Number of values */
+            std::vector<std::uint64_t> primes;  /*!< The primes, in order */
+            std::vector<std::uint64_t> digits;  /*!< The digits of the values, prime after prime */
+            BigInt product;                     /*!< Product of the primes */
+
+        public:
+            explicit MixedRadix(std::size_t n)
+                : count(n), product(1)
+            {}
+
+            std::size_t size() const
+            {
+                return primes.size();
+            }
+
+            const BigInt &modulus() const
+            {
+                return product;
+            }
+
+            /**
+             * \brief Addition of a prime
+             * \param[in] p The prime, distinct from the previous ones
+             * \param[in] residues The residues of the values modulo p
+             * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+             */
+            void append(std::uint64_t p, const std::uint64_t *residues, unsigned threads)
+            {
+                const Montgomery field(p);
+                const std::size_t k = primes.size();
+
+                std::vector<std::uint64_t> radix(k);
+                std::uint64_t previous = field.to(1);
+                for (std::size_t j = 0; j < k; j++)
+                {
+                    radix[j] = field.to(primes[j] % p);
+                    previous = field.multiply(previous, radix[j]);
+                }
+                const std::uint64_t inverse = field.inverse(previous);
+
+                digits.resize((k + 1) * count);
+                std::uint64_t *next = digits.data() + k * count;
+                parallelFor(count, threadCount(count * (k + 1), 1 << 12, threads), [&](unsigned, std::size_t begin, std::size_t end) {
+                    for (std::size_t i = begin; i < end; i++)
+                    {
+                        // Value modulo p of the previous digits, by Horner's rule
+                        std::uint64_t x = 0;
+                        for (std::size_t j = k; j-- > 0;)
+                            x = field.add(field.multiply(x, radix[j]), field.to(digits[j * count + i] % p));
+
+                        next[i] = field.from(field.multiply(field.sub(field.to(residues[i]), x), inverse));
+                    }
+                });
+
+                primes.push_back(p);
+                product *= BigInt(p);
+            }
+
+            /**
+             * \brief Value in [0, modulus())
+             * \param[in] i Index of the value
+             */
+            BigInt value(std::size_t i) const
+            {
+                BigInt x(0);
+                for (std::size_t j = primes.size(); j-- > 0;)
+                    x = x * BigInt(primes[j]) + BigInt(digits[j * count + i]);
+
+                return x;
+            }
+        };
+
+
+        /**
+         * \brief Rational reconstruction
+         * \param[in] u Residue in [0, m)
+         * \param[in] m The modulus
+         * \param[out] num Numerator n
+         * \param[out] denom Denominator d, positive
+         * \return False if no fraction n/d = u modulo m with |n| < 2^b and 2^(b+1) d < m, where b = (bits(m) - 1) / 2
+         *
+         * The extended Euclidean algorithm on (m, u) is stopped at the first
+         * remainder below 2^b; by Wang's theorem, the fraction is unique and
+         * found there whenever it exists.
+         */
+        inline bool reconstruct(const BigInt &u, const BigInt &m, BigInt &num, BigInt &denom)
+        {
+            const unsigned int bits = m.bitLength(), half = (bits - 1) / 2;
+
+            BigInt r0 = m, r1 = u, t0(0), t1(1), q, r2;
+            while (r1.bitLength() > half)
+            {
+                BigInt::divmod(r0, r1, q, r2);
+                BigInt t2 = t0 - q * t1;
+                r0 = std::move(r1);
+                r1 = std::move(r2);
+                t0 = std::move(t1);
+                t1 = std::move(t2);
+            }
+
+            if (t1.bitLength() + half + 2 > bits || AutoGCD::compute(r1, t1) != BigInt(1))
+                return false;
+
+            num = t1.sign() < 0 ? -r1 : r1;
+            denom = t1.sign() < 0 ? -t1 : t1;
+            return true;
+        }
+
+
+        /**
+         * \brief Number of bits of the Hadamard bound of the determinant of integer rows
+         */
+        inline std::size_t hadamardBits(const std::vector<BigInt> &m, std::size_t rows, std::size_t cols)
+        {
+            std::size_t bits = 0;
+            for (std::size_t i = 0; i < rows; i++)
+            {
+                BigInt norm(0);
+                for (std::size_t j = 0; j < cols; j++)
+                    norm += m[i * cols + j] * m[i * cols + j];
+                bits += norm.bitLength() / 2 + 1;
+            }
+
+            return bits;
+        }
+
+
+        /**
+         * \brief Splitting of integer rows in words, in parallel
+         */
+        inline std::vector<Words> splitAll(const std::vector<BigInt> &m, unsigned threads)
+        {
+            std::vector<Words> result(m.size());
+            parallelFor(m.size(), threadCount(m.size(), 1 << 10, threads), [&](unsigned, std::size_t begin, std::size_t end) {
+                for (std::size_t k = begin; k < end; k++)
+                    result[k] = split(m[k]);
+            });
+
+            return result;
+        }
+
+
+        /**
+         * \brief First candidate of the decreasing sequence of primes
+         *
+         * All the primes are then in (2^61, 2^62), each above half of any other.
+         */
+        const std::uint64_t firstPrimeCandidate = (std::uint64_t(1) << 62) - 1;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Fraction<T1, T2, Policy> determinantModular(const Matrix<T1, T2, Policy> &a, unsigned threads)
+    {
+        typedef Fraction<T1, T2, Policy> F;
+        assertm(a.rows() == a.cols(), "The determinant needs a square matrix");
+
+        const std::size_t n = a.rows();
+        if (n == 0)
+            return F(T1(1));
+
+        BigInt scale(1);
+        const std::vector<BigInt> m = a.scaledRows(nullptr, &scale);
+        const std::vector<detail::Words> words = detail::splitAll(m, threads);
+
+        // 61 bits per prime, |det| <= 2^bits and the symmetric range needs one more
+        const std::size_t needed = (detail::hadamardBits(m, n, n) + 1) / 61 + 1;
+        const unsigned chunks = detail::threadCount(needed, 1, threads);
+
+        std::uint64_t candidate = detail::firstPrimeCandidate;
+        std::vector<std::uint64_t> primes(needed), residues(needed);
+        for (std::uint64_t &p : primes)
+            p = detail::nextPrime(candidate);
+
+        detail::parallelFor(needed, chunks, [&](unsigned, std::size_t begin, std::size_t end) {
+            for (std::size_t k = begin; k < end; k++)
+                detail::eliminateModular(words, n, n, detail::Montgomery(primes[k]), nullptr, residues[k]);
+        });
+
+        detail::MixedRadix crt(1);
+        for (std::size_t k = 0; k < needed; k++)
+            crt.append(primes[k], &residues[k], 1);
+
+        BigInt det = crt.value(0);
+        if (BigInt(2) * det > crt.modulus())
+            det -= crt.modulus();
+
+        return detail::fromBigInts<F>(det, scale);
+    }
+
+
+    template <class T1, class T2, class Policy>
+    Matrix<T1, T2, Policy> solveModular(const Matrix<T1, T2, Policy> &a, const Matrix<T1, T2, Policy> &b, unsigned threads)
+    {
+        assertm(a.rows() == a.cols(), "The system should be square");
+        assertm(b.rows() == a.rows(), "The right-hand sides should have as many rows as the system");
+
+        const std::size_t n = a.rows(), extra = b.cols(), cols = n + extra, count = n * extra;
+        Matrix<T1, T2, Policy> x(n, extra);
+        if (count == 0)
+            return x;
+
+        const std::vector<BigInt> m = a.scaledRows(&b);
+        const std::vector<detail::Words> words = detail::splitAll(m, threads);
+        const unsigned chunks = detail::threadCount(std::size_t(-1), 1, threads);
+
+        std::uint64_t candidate = detail::firstPrimeCandidate;
+        detail::MixedRadix crt(count);
+        std::vector<BigInt> nums(count), denoms(count);
+        std::size_t probe = count - 1;
+        bool first = true;
+
+        for (;;)
+        {
+            // One round: a prime per thread
+            std::vector<std::uint64_t> primes(chunks), residues(chunks * count);
+            for (std::uint64_t &p : primes)
+                p = detail::nextPrime(candidate);
+
+            std::vector<char> regular(chunks, 0);
+            detail::parallelFor(chunks, chunks, [&](unsigned, std::size_t begin, std::size_t end) {
+                for (std::size_t k = begin; k < end; k++)
+                {
+                    std::uint64_t det = 0;
+                    regular[k] = detail::eliminateModular(words, n, cols, detail::Montgomery(primes[k]), residues.data() + k * count, det);
+                }
+            });
+
+            for (unsigned k = 0; k < chunks; k++)
+            {
+                // Singular modulo p: either A is singular, or p divides its determinant
+                if (!regular[k])
+                {
+                    if (first && determinantModular(a, threads) == Fraction<T1, T2, Policy>())
+                        throw std::domain_error("frac::solveModular: singular matrix");
+                    first = false;
+                    continue;
+                }
+
+                first = false;
+                crt.append(primes[k], residues.data() + k * count, threads);
+            }
+
+            // Early termination: one entry is tried first, then all, then the system is checked exactly
+            if (crt.size() == 0 || !detail::reconstruct(crt.value(probe), crt.modulus(), nums[probe], denoms[probe]))
+                continue;
+
+            // The denominators divide det(A): multiplying by the common denominator found so far usually
+            // leaves a small integer, and the Euclidean algorithm only runs for the other entries
+            BigInt common = denoms[probe];
+            std::size_t failed = count;
+            for (std::size_t i = 0; i < count && failed == count; i++)
+            {
+                BigInt v = crt.value(i) * common % crt.modulus();
+                if (BigInt(2) * v > crt.modulus())
+                    v -= crt.modulus();
+
+                if (v.bitLength() + common.bitLength() + 2 <= crt.modulus().bitLength())
+                {
+                    const BigInt g = AutoGCD::compute(v, common);
+                    nums[i] = v / g;
+                    denoms[i] = common / g;
+                } else if (detail::reconstruct(crt.value(i), crt.modulus(), nums[i], denoms[i]))
+                    common = common / AutoGCD::compute(common, denoms[i]) * denoms[i];
+                else
+                    failed = i;
+            }
+
+            if (failed < count)
+            {
+                probe = failed;
+                continue;
+            }
+
+            bool exact = true;
+            for (std::size_t j = 0; j < extra && exact; j++)
+            {
+                // Common denominator of the column of the solution
+                BigInt common(1);
+                for (std::size_t i = 0; i < n; i++)
+                    common = common / AutoGCD::compute(common, denoms[i * extra + j]) * denoms[i * extra + j];
+
+                std::vector<BigInt> y(n);
+                for (std::size_t i = 0; i < n; i++)
+                    y[i] = nums[i * extra + j] * (common / denoms[i * extra + j]);
+
+                for (std::size_t i = 0; i < n && exact; i++)
+                {
+                    BigInt lhs(0);
+                    for (std::size_t k = 0; k < n; k++)
+                    {
+                        if (m[i * cols + k].sign() != 0)
+                            lhs += m[i * cols + k] * y[k];
+                    }
+                    exact = lhs == m[i * cols + n + j] * common;
+                }
+            }
+
+            if (exact)
+                break;
+        }
+
+        for (std::size_t i = 0; i < n; i++)
+        {
+            for (std::size_t j = 0; j < extra; j++)
+                x(i, j) = detail::fromBigInts<Fraction<T1, T2, Policy>>(nums[i * extra + j], denoms[i * extra + j]);
+        }
+
+        return x;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    std::vector<Fraction<T1, T2, Policy>> solveModular(const Matrix<T1, T2, Policy> &a, const std::vector<Fraction<T1, T2, Policy>> &b,
+                                                       unsigned threads)
+    {
+        Matrix<T1, T2, Policy> column(b.size(), 1);
+        for (std::size_t i = 0; i < b.size(); i++)
+            column(i, 0) = b[i];
+
+        Matrix<T1, T2, Policy> x = solveModular(a, column, threads);
+
+        std::vector<Fraction<T1, T2, Policy>> result(b.size());
+        for (std::size_t i = 0; i < b.size(); i++)
+            result[i] = x(i, 0);
+
+        return result;
+    }
+}
+
+
+#endif  /*_MODULAR_H_*/
@@ -0,0 +1,739 @@
+#ifndef _PACKED_H_
+#define _PACKED_H_
+
+/**
+ * \file packed.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Compact fractions packed in a single machine word, promoted to Fraction when they do not fit
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "fraction.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /**
+     * \class PackedFraction
+     * \brief Irreducible fraction packed in an unsigned word, numerator in the high bits
+     *
+     * The numerator takes NumeratorBits bits, in two's complement without its
+     * most negative value, so that negation always fits. The denominator d,
+     * from 1 to 2^(bits of Word - NumeratorBits), is stored as d - 1 in the
+     * low bits: the zero word is 0/1.
+     *
+     * The type is trivially copyable. It converts implicitly to the wider
+     * Fraction Wide, and its arithmetic gives results of type Wide; packing a
+     * Wide value back may fail, see pack(). Terms too large for the integers
+     * of Wide, as in sums of Packed64<32> with denominators near 2^32, are
+     * left to the arithmetic policy of Wide: the default one redoes the
+     * operation in 128 bits and throws std::overflow_error if the irreducible
+     * result does not fit, an unchecked one wraps silently.
+     * Reductions of small terms use the precomputed tables of
+     * detail::PackedTables instead of a GCD engine and divisions.
+     */
+    template <class Word, unsigned int NumeratorBits, class Wide = Fraction<long long, double, WithArithmetic<WideningArithmetic<>>>>
+    class PackedFraction
+    {
+        static_assert(std::is_unsigned<Word>::value && sizeof(Word) <= 8, "frac::PackedFraction needs an unsigned word of at most 64 bits");
+        static_assert(NumeratorBits >= 2 && NumeratorBits < 8 * sizeof(Word), "frac::PackedFraction needs bits for both terms");
+
+    public:
+        typedef Word word_type;                                 /*!< Type of the packed word */
+        typedef Wide wide_type;                                 /*!< Type of the promoted fractions */
+        typedef typename Wide::integer_type integer_type;       /*!< Type of the unpacked terms */
+        typedef typename Wide::floating_type floating_type;     /*!< Type of the value given by evaluate() */
+
+        static const unsigned int numerator_bits = NumeratorBits;                       /*!< Width of the numerator field */
+        static const unsigned int denominator_bits = 8 * sizeof(Word) - NumeratorBits;  /*!< Width of the denominator field */
+
+        static_assert(8 * sizeof(integer_type) >= NumeratorBits + denominator_bits, "frac::PackedFraction: Wide too narrow for the products");
+
+    private:
+        Word bits = 0;  /*!< Numerator and denominator - 1 */
+
+    public:
+        /**
+         * \brief Default constructor, fraction equal to 0
+         */
+        constexpr PackedFraction() = default;
+
+        /**
+         * \brief Constructor
+         * \param[in] num Numerator
+         * \param[in] denom Non zero denominator
+         *
+         * The fraction is reduced; throws std::overflow_error if it does not fit.
+         */
+        PackedFraction(integer_type num, integer_type denom = 1);
+
+        /**
+         * \brief Constructor from a wider fraction
+         * \param[in] frac The fraction to be packed
+         *
+         * Throws std::overflow_error if it does not fit.
+         */
+        explicit constexpr PackedFraction(const Wide &frac);
+
+        /**
+         * \brief Packing of a wider fraction
+         * \param[in] frac The fraction to be packed
+         * \param[out] packed The packed fraction, unchanged if frac does not fit
+         * \return False if frac does not fit
+         */
+        static constexpr bool pack(const Wide &frac, PackedFraction &packed);
+
+        /**
+         * \brief Packed fraction from its raw word, see word()
+         * \param[in] word A word given by word()
+         * \return The packed fraction
+         */
+        static constexpr PackedFraction fromWord(Word word);
+
+        /**
+         * \brief Raw word getter
+         * \return The packed numerator and denominator
+         */
+        constexpr Word word() const;
+
+        /**
+         * \brief Numerator getter
+         * \return The numerator
+         */
+        constexpr integer_type getNum() const;
+
+        /**
+         * \brief Denominator getter
+         * \return The positive denominator
+         */
+        constexpr integer_type getDenom() const;
+
+        /**
+         * \brief Promotion to the wider fraction
+         * \return The same value as Wide
+         */
+        constexpr operator Wide() const;
+
+        /**
+         * \brief Evaluation of the fraction's value, correctly rounded as Fraction::evaluate()
+         * \return The floating value
+         */
+        constexpr floating_type evaluate() const;
+
+        /**
+         * \brief Overloading of unary - operator
+         * \return The opposite fraction, which always fits
+         */
+        constexpr PackedFraction operator-() const;
+
+        constexpr bool operator==(const PackedFraction &other) const;  /*!< \brief Overloading of == operator */
+        constexpr bool operator!=(const PackedFraction &other) const;  /*!< \brief Overloading of != operator */
+        constexpr bool operator<(const PackedFraction &other) const;   /*!< \brief Overloading of < operator */
+        constexpr bool operator<=(const PackedFraction &other) const;  /*!< \brief Overloading of <= operator */
+        constexpr bool operator>(const PackedFraction &other) const;   /*!< \brief Overloading of > operator */
+        constexpr bool operator>=(const PackedFraction &other) const;  /*!< \brief Overloading of >= operator */
+
+    private:
+        /**
+         * \brief Packing of irreducible terms
+         * \return False if they do not fit
+         */
+        static constexpr bool fits(integer_type num, integer_type denom);
+    };
+
+
+    /**
+     * \brief Fraction of int16_t range packed in 32 bits
+     */
+    typedef PackedFraction<std::uint32_t, 16> Packed32;
+
+    /**
+     * \brief Fraction packed in 64 bits, NumeratorBits for the numerator and the rest for the denominator
+     */
+    template <unsigned int NumeratorBits = 32>
+    using Packed64 = PackedFraction<std::uint64_t, NumeratorBits>;
+
+
+    /**
+     * \brief Overloading of + operator, promoting to the wider fraction
+     */
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    Wide operator+(const PackedFraction<Word, NumeratorBits, Wide> &a, const PackedFraction<Word, NumeratorBits, Wide> &b);
+
+    /**
+     * \brief Overloading of - operator, promoting to the wider fraction
+     */
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    Wide operator-(const PackedFraction<Word, NumeratorBits, Wide> &a, const PackedFraction<Word, NumeratorBits, Wide> &b);
+
+    /**
+     * \brief Overloading of * operator, promoting to the wider fraction
+     */
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    Wide operator*(const PackedFraction<Word, NumeratorBits, Wide> &a, const PackedFraction<Word, NumeratorBits, Wide> &b);
+
+    /**
+     * \brief Overloading of / operator, promoting to the wider fraction
+     */
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    Wide operator/(const PackedFraction<Word, NumeratorBits, Wide> &a, const PackedFraction<Word, NumeratorBits, Wide> &b);
+
+    /**
+     * \brief Overloading of << operator, see Fraction
+     */
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    std::ostream &operator<<(std::ostream &o, const PackedFraction<Word, NumeratorBits, Wide> &frac);
+
+
+    /**
+     * \class PackedArray
+     * \brief Array of packed fractions, the elements which do not fit being promoted
+     *
+     * Elements are stored as packed words. An element which does not fit is
+     * kept as a Wide fraction in a side table, its word holding a marker
+     * (the reserved most negative numerator), so that the array stays exact
+     * whatever is stored in it.
+     */
+    template <class Packed>
+    class PackedArray
+    {
+    public:
+        typedef typename Packed::wide_type value_type;      /*!< Type of the elements */
+        typedef typename Packed::word_type word_type;       /*!< Type of the packed words */
+
+    private:
+        std::vector<word_type> words;                           /*!< Packed elements, or markers */
+        std::unordered_map<std::size_t, value_type> promoted;   /*!< Elements which do not fit, by index */
+
+        /**
+         * \brief Word marking a promoted element
+         */
+        static constexpr word_type marker();
+
+    public:
+        /**
+         * \brief Default constructor, empty array
+         */
+        PackedArray();
+
+        /**
+         * \brief Constructor
+         * \param[in] size Number of elements, all equal to zero
+         */
+        explicit PackedArray(std::size_t size);
+
+        /**
+         * \brief Number of elements
+         * \return The size of the array
+         */
+        std::size_t size() const;
+
+        /**
+         * \brief Change of the number of elements, new ones are zero
+         * \param[in] size The new size
+         */
+        void resize(std::size_t size);
+
+        /**
+         * \brief Reservation of memory
+         * \param[in] capacity Number of elements to make room for
+         */
+        void reserve(std::size_t capacity);
+
+        /**
+         * \brief Addition of an element at the end
+         * \param[in] frac The fraction to be added
+         */
+        void push_back(const value_type &frac);
+
+        /**
+         * \brief Element getter
+         * \param[in] i Index of the element
+         * \return The fraction at index i
+         */
+        value_type operator[](std::size_t i) const;
+
+        /**
+         * \brief Element setter
+         * \param[in] i Index of the element
+         * \param[in] frac The fraction to be stored
+         */
+        void set(std::size_t i, const value_type &frac);
+
+        /**
+         * \brief Tells whether an element is stored packed
+         * \param[in] i Index of the element
+         * \return False if the element was promoted
+         */
+        bool isPacked(std::size_t i) const;
+
+        /**
+         * \brief Packed element getter
+         * \param[in] i Index of an element such that isPacked(i)
+         * \return The packed element
+         */
+        Packed packed(std::size_t i) const;
+
+        /**
+         * \brief Number of promoted elements
+         * \return The number of elements which do not fit in a packed word
+         */
+        std::size_t promotedCount() const;
+
+        /**
+         * \brief Evaluation of every element
+         * \param[out] values Array of size() floating values
+         */
+        void evaluate(typename value_type::floating_type *values) const;
+    };
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    namespace detail
+    {
+        /**
+         * \struct PackedTables
+         * \brief Tables for the reduction of small terms
+         *
+         * gcd[a][b] for a, b < limit, and the inverses modulo 2^64 of the odd
+         * integers below limit, which turn exact divisions by them into
+         * multiplications. 16 KiB in all, to stay in the L1 cache.
+         */
+        struct PackedTables
+        {
+            static const unsigned int limit = 128;  /*!< Bound on the tabulated terms */
+
+            std::uint8_t gcd[limit][limit];         /*!< Greatest common divisors */
+            std::uint64_t inverse[limit];           /*!< Inverses of the odd integers modulo 2^64, 0 for even ones */
+
+            PackedTables()
+            {
+                // By increasing max(a, b): gcd(a, b) = gcd(a - b, b) is already known
+                for (unsigned int a = 0; a < limit; a++)
+                {
+                    gcd[a][0] = gcd[0][a] = std::uint8_t(a);
+                    for (unsigned int b = 1; b <= a; b++)
+                        gcd[a][b] = gcd[b][a] = gcd[a - b][b];
+                }
+
+                for (unsigned int k = 0; k < limit; k++)
+                {
+                    // Newton iteration, each step doubles the number of correct low bits
+                    std::uint64_t x = k;
+                    for (int i = 0; i < 5; i++)
+                        x *= 2 - k * x;
+                    inverse[k] = k % 2 == 1 ? x : 0;
+                }
+            }
+
+            /**
+             * \brief The tables, built on first use
+             */
+            static const PackedTables &get()
+            {
+                static const PackedTables tables;
+                return tables;
+            }
+        };
+
+
+        /**
+         * \brief Reduction of a fraction, the tables used for small terms
+         * \param[in,out] num Numerator
+         * \param[in,out] denom Nonzero denominator, positive on return
+         * \return False if the reduced fraction has no representation in I, as -min/-1
+         *
+         * The terms are handled as unsigned magnitudes, so that the most
+         * negative values are reduced before any opposite is taken.
+         */
+        template <class GCD, class I>
+        bool reducePacked(I &num, I &denom)
+        {
+            typedef typename Unsigned<I>::type U;
+            const PackedTables &tables = PackedTables::get();
+
+            const bool negative = (num < 0) != (denom < 0);
+            U qa = magnitude(num), qb = magnitude(denom);
+            const U g = qa < PackedTables::limit && qb < PackedTables::limit ? U(tables.gcd[qa][qb]) : U(GCD::compute(qa, qb));
+
+            if constexpr (sizeof(U) <= 8)
+            {
+                if (g > 1 && g < PackedTables::limit)
+                {
+                    // Exact divisions: shift of the power of two, then product by the inverse mod 2^64 of the odd part
+                    const int shift = ctz(g);
+                    const U inverse = U(tables.inverse[g >> shift]);
+                    qa = U((qa >> shift) * inverse);
+                    qb = U((qb >> shift) * inverse);
+                } else if (g > 1) {
+                    qa /= g;
+                    qb /= g;
+                }
+            } else if (g > 1) {
+                qa /= g;
+                qb /= g;
+            }
+
+            const U max = U(largest<I>());
+            if (qb > max || (!negative && qa > max))
+                return false;
+
+            num = negative ? I(U(0) - qa) : I(qa);
+            denom = I(qb);
+            return true;
+        }
+
+
+        /**
+         * \brief Wide fraction from terms computed without overflow, reduced with the tables
+         */
+        template <class Wide>
+        Wide packedResult(typename Wide::integer_type num, typename Wide::integer_type denom)
+        {
+            reducePacked<typename Wide::policy_type::gcd>(num, denom);
+            return Wide(num, denom, irreducible);
+        }
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    PackedFraction<Word, NumeratorBits, Wide>::PackedFraction(integer_type num, integer_type denom)
+    {
+        assertm(denom != 0, "Error: division by zero");
+
+        if (!detail::reducePacked<typename Wide::policy_type::gcd>(num, denom) || !fits(num, denom))
+            throw std::overflow_error("frac::PackedFraction: value out of range");
+
+        bits = Word(Word(num) << denominator_bits) | Word(denom - 1);
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr PackedFraction<Word, NumeratorBits, Wide>::PackedFraction(const Wide &frac)
+    {
+        if (!pack(frac, *this))
+            throw std::overflow_error("frac::PackedFraction: value out of range");
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr bool PackedFraction<Word, NumeratorBits, Wide>::fits(integer_type num, integer_type denom)
+    {
+        const integer_type bound = integer_type(1) << (NumeratorBits - 1);
+        if (num >= bound || num <= -bound)
+            return false;
+
+        if constexpr (denominator_bits < 8 * sizeof(integer_type) - 1)
+            return denom <= (integer_type(1) << denominator_bits);
+        else
+            return true;
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr bool PackedFraction<Word, NumeratorBits, Wide>::pack(const Wide &frac, PackedFraction &packed)
+    {
+        const integer_type num = frac.getNum(), denom = frac.getDenom();
+        if (!fits(num, denom))
+            return false;
+
+        packed.bits = Word(Word(num) << denominator_bits) | Word(denom - 1);
+        return true;
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr PackedFraction<Word, NumeratorBits, Wide> PackedFraction<Word, NumeratorBits, Wide>::fromWord(Word word)
+    {
+        PackedFraction packed;
+        packed.bits = word;
+        return packed;
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr Word PackedFraction<Word, NumeratorBits, Wide>::word() const
+    {
+        return bits;
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr typename PackedFraction<Word, NumeratorBits, Wide>::integer_type PackedFraction<Word, NumeratorBits, Wide>::getNum() const
+    {
+        // Arithmetic shift of the signed word
+        return integer_type(typename std::make_signed<Word>::type(bits) >> denominator_bits);
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr typename PackedFraction<Word, NumeratorBits, Wide>::integer_type PackedFraction<Word, NumeratorBits, Wide>::getDenom() const
+    {
+        return integer_type(bits & (Word(-1) >> NumeratorBits)) + 1;
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr PackedFraction<Word, NumeratorBits, Wide>::operator Wide() const
+    {
+        return Wide(this->getNum(), this->getDenom(), irreducible);
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr typename PackedFraction<Word, NumeratorBits, Wide>::floating_type PackedFraction<Word, NumeratorBits, Wide>::evaluate() const
+    {
+        return detail::quotient<floating_type>(this->getNum(), this->getDenom());
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr PackedFraction<Word, NumeratorBits, Wide> PackedFraction<Word, NumeratorBits, Wide>::operator-() const
+    {
+        return fromWord(Word(Word(-this->getNum()) << denominator_bits) | Word(bits & (Word(-1) >> NumeratorBits)));
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr bool PackedFraction<Word, NumeratorBits, Wide>::operator==(const PackedFraction &other) const
+    {
+        // Both are irreducible
+        return bits == other.bits;
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr bool PackedFraction<Word, NumeratorBits, Wide>::operator!=(const PackedFraction &other) const
+    {
+        return bits != other.bits;
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr bool PackedFraction<Word, NumeratorBits, Wide>::operator<(const PackedFraction &other) const
+    {
+        // The products fit in integer_type, see the static assertion
+        return this->getNum() * other.getDenom() < other.getNum() * this->getDenom();
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr bool PackedFraction<Word, NumeratorBits, Wide>::operator<=(const PackedFraction &other) const
+    {
+        return !(other < *this);
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr bool PackedFraction<Word, NumeratorBits, Wide>::operator>(const PackedFraction &other) const
+    {
+        return other < *this;
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    constexpr bool PackedFraction<Word, NumeratorBits, Wide>::operator>=(const PackedFraction &other) const
+    {
+        return !(*this < other);
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    Wide operator+(const PackedFraction<Word, NumeratorBits, Wide> &a, const PackedFraction<Word, NumeratorBits, Wide> &b)
+    {
+        typedef typename Wide::integer_type I;
+        typedef CheckedArithmetic<> A;
+
+        bool overflow = false;
+        const I num = A::add(A::mul(a.getNum(), b.getDenom(), overflow), A::mul(b.getNum(), a.getDenom(), overflow), overflow);
+        const I denom = A::mul(a.getDenom(), b.getDenom(), overflow);
+
+        // Terms too wide for the unreduced sum: the policy of Wide decides
+        if (overflow)
+            return Wide(a) + Wide(b);
+
+        return detail::packedResult<Wide>(num, denom);
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    Wide operator-(const PackedFraction<Word, NumeratorBits, Wide> &a, const PackedFraction<Word, NumeratorBits, Wide> &b)
+    {
+        return a + (-b);
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    Wide operator*(const PackedFraction<Word, NumeratorBits, Wide> &a, const PackedFraction<Word, NumeratorBits, Wide> &b)
+    {
+        typedef typename Wide::integer_type I;
+        typedef CheckedArithmetic<> A;
+
+        bool overflow = false;
+        const I num = A::mul(a.getNum(), b.getNum(), overflow);
+        const I denom = A::mul(a.getDenom(), b.getDenom(), overflow);
+
+        if (overflow)
+            return Wide(a) * Wide(b);
+
+        return detail::packedResult<Wide>(num, denom);
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    Wide operator/(const PackedFraction<Word, NumeratorBits, Wide> &a, const PackedFraction<Word, NumeratorBits, Wide> &b)
+    {
+        typedef typename Wide::integer_type I;
+        typedef CheckedArithmetic<> A;
+        assertm(b.getNum() != 0, "Error: division by zero");
+
+        bool overflow = false;
+        const I sign = b.getNum() < 0 ? I(-1) : I(1);
+        const I num = A::mul(a.getNum(), I(sign * b.getDenom()), overflow);
+        const I denom = A::mul(a.getDenom(), I(sign * b.getNum()), overflow);
+
+        if (overflow)
+            return Wide(a) / Wide(b);
+
+        return detail::packedResult<Wide>(num, denom);
+    }
+
+
+    template <class Word, unsigned int NumeratorBits, class Wide>
+    std::ostream &operator<<(std::ostream &o, const PackedFraction<Word, NumeratorBits, Wide> &frac)
+    {
+        return o << Wide(frac);
+    }
+
+
+    template <class Packed>
+    constexpr typename PackedArray<Packed>::word_type PackedArray<Packed>::marker()
+    {
+        // Numerator -2^(NumeratorBits - 1), never packed
+        return word_type(word_type(1) << (8 * sizeof(word_type) - 1));
+    }
+
+
+    template <class Packed>
+    PackedArray<Packed>::PackedArray()
+    {
+    }
+
+
+    template <class Packed>
+    PackedArray<Packed>::PackedArray(std::size_t size)
+        : words(size, word_type(0))
+    {
+    }
+
+
+    template <class Packed>
+    std::size_t PackedArray<Packed>::size() const
+    {
+        return words.size();
+    }
+
+
+    template <class Packed>
+    void PackedArray<Packed>::resize(std::size_t size)
+    {
+        for (auto it = promoted.begin(); it != promoted.end();)
+            it = it->first >= size ? promoted.erase(it) : std::next(it);
+
+        words.resize(size, word_type(0));
+    }
+
+
+    template <class Packed>
+    void PackedArray<Packed>::reserve(std::size_t capacity)
+    {
+        words.reserve(capacity);
+    }
+
+
+    template <class Packed>
+    void PackedArray<Packed>::push_back(const value_type &frac)
+    {
+        words.push_back(word_type(0));
+        this->set(words.size() - 1, frac);
+    }
+
+
+    template <class Packed>
+    typename PackedArray<Packed>::value_type PackedArray<Packed>::operator[](std::size_t i) const
+    {
+        if (words[i] == marker())
+            return promoted.at(i);
+
+        return value_type(Packed::fromWord(words[i]));
+    }
+
+
+    template <class Packed>
+    void PackedArray<Packed>::set(std::size_t i, const value_type &frac)
+    {
+        Packed packed;
+        if (Packed::pack(frac, packed))
+        {
+            if (words[i] == marker())
+                promoted.erase(i);
+            words[i] = packed.word();
+        } else {
+            words[i] = marker();
+            promoted[i] = frac;
+        }
+    }
+
+
+    template <class Packed>
+    bool PackedArray<Packed>::isPacked(std::size_t i) const
+    {
+        return words[i] != marker();
+    }
+
+
+    template <class Packed>
+    Packed PackedArray<Packed>::packed(std::size_t i) const
+    {
+        assertm(this->isPacked(i), "The element was promoted");
+        return Packed::fromWord(words[i]);
+    }
+
+
+    template <class Packed>
+    std::size_t PackedArray<Packed>::promotedCount() const
+    {
+        return promoted.size();
+    }
+
+
+    template <class Packed>
+    void PackedArray<Packed>::evaluate(typename value_type::floating_type *values) const
+    {
+        for (std::size_t i = 0; i < words.size(); i++)
+            values[i] = words[i] == marker() ? promoted.at(i).evaluate() : Packed::fromWord(words[i]).evaluate();
+    }
+}
+
+
+#endif  /*_PACKED_H_*/
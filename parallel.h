@@ -0,0 +1,128 @@
+#ifndef _PARALLEL_H_
+#define _PARALLEL_H_
+
+/**
+ * \file parallel.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Minimal helpers to split work on ranges across threads
+ */
+
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    namespace detail
+    {
+        /**
+         * \brief Number of threads worth starting for a given amount of work
+         * \param[in] size Number of elements to process
+         * \param[in] grain Minimal number of elements per thread
+         * \param[in] threads Requested number of threads, 0 for the hardware concurrency
+         * \return A number of threads between 1 and size / grain
+         */
+        inline unsigned threadCount(std::size_t size, std::size_t grain, unsigned threads = 0)
+        {
+            if (threads == 0)
+                threads = std::thread::hardware_concurrency();
+            if (threads == 0)
+                threads = 1;
+
+            std::size_t useful = grain ? size / grain : size;
+            if (useful < threads)
+                threads = useful ? unsigned(useful) : 1;
+
+            return threads;
+        }
+
+
+        /**
+         * \brief Runs a function on contiguous chunks of [0, size), one chunk per thread
+         * \param[in] size Number of elements
+         * \param[in] chunks Number of chunks, as given by threadCount()
+         * \param[in] function Callable as function(chunk, begin, end)
+         *
+         * The first chunk runs on the calling thread. An exception thrown by
+         * any chunk is rethrown once all of them are done.
+         */
+        template <class Function>
+        void parallelFor(std::size_t size, unsigned chunks, Function &&function)
+        {
+            if (chunks <= 1)
+            {
+                function(0u, std::size_t(0), size);
+                return;
+            }
+
+            std::vector<std::exception_ptr> errors(chunks);
+            std::vector<std::thread> workers;
+            workers.reserve(chunks - 1);
+
+            auto run = [&](unsigned chunk) {
+                std::size_t begin = size * chunk / chunks, end = size * (chunk + 1) / chunks;
+                try {
+                    function(chunk, begin, end);
+                } catch (...) {
+                    errors[chunk] = std::current_exception();
+                }
+            };
+
+            for (unsigned chunk = 1; chunk < chunks; chunk++)
+                workers.emplace_back(run, chunk);
+            run(0);
+
+            for (std::thread &worker : workers)
+                worker.join();
+
+            for (std::exception_ptr &error : errors)
+            {
+                if (error)
+                    std::rethrow_exception(error);
+            }
+        }
+
+
+        /**
+         * \brief Pairwise reduction of values in a balanced tree
+         * \param[in] values The values to combine, left empty
+         * \param[in] identity Result for an empty input
+         * \param[in] combine Associative callable returning the combination of two values
+         * \return The combination of all values, in their order
+         *
+         * Each value takes part in about log2(n) combinations, which keeps the
+         * operands of similar size instead of growing a single accumulator.
+         */
+        template <class T, class Combine>
+        T treeReduce(std::vector<T> &values, T identity, Combine &&combine)
+        {
+            if (values.empty())
+                return identity;
+
+            for (std::size_t width = values.size(); width > 1; width = (width + 1) / 2)
+            {
+                for (std::size_t i = 0; i + 1 < width; i += 2)
+                    values[i / 2] = combine(values[i], values[i + 1]);
+                if (width % 2)
+                    values[width / 2] = std::move(values[width - 1]);
+            }
+
+            T result = std::move(values.front());
+            values.clear();
+
+            return result;
+        }
+    }
+}
+
+
+#endif  /*_PARALLEL_H_*/
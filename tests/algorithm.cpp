@@ -0,0 +1,247 @@
+/**
+ * \file algorithm.cpp
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Checks of dot(), fma() and axpy() against the naive loops on the operators
+ * of Fraction; the program returns the number of failed checks
+ *
+ * g++ -std=c++17 -O2 -Wall -Wextra -pthread -I.. algorithm.cpp -o algorithm
+ */
+
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "../algorithm.h"
+#include "../bigint.h"
+
+using namespace frac;
+
+
+static int failures = 0;
+
+static void check(bool condition, const std::string &what)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+
+/**
+ * \brief Operands of the three functions
+ */
+template <class F>
+struct Data
+{
+    std::vector<F> a, b, c;
+};
+
+
+// Random fractions whose denominators divide base, so that the exact sums
+// of the products still fit in the integer type for the naive loop
+template <class F>
+Data<F> randomData(std::size_t size, std::mt19937_64 &random, int base, int range)
+{
+    std::vector<int> denominators;
+    for (int d = 1; d <= base; d++)
+        if (base % d == 0)
+            denominators.push_back(d);
+
+    std::uniform_int_distribution<int> num(-range, range), pick(0, int(denominators.size()) - 1);
+    Data<F> data;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        data.a.push_back(F(num(random), denominators[pick(random)]));
+        data.b.push_back(F(num(random), denominators[pick(random)]));
+        data.c.push_back(F(num(random), denominators[pick(random)]));
+    }
+    return data;
+}
+
+
+// Few distinct denominators, so that the products form large groups
+template <class F>
+Data<F> groupedData(std::size_t size, std::mt19937_64 &random, int range)
+{
+    static const int denominators[] = {2, 3, 6, 12, 360};
+    std::uniform_int_distribution<int> num(-range, range), pick(0, 4);
+    Data<F> data;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        data.a.push_back(F(num(random), denominators[pick(random)]));
+        data.b.push_back(F(num(random), denominators[pick(random)]));
+        data.c.push_back(F(num(random), denominators[pick(random)]));
+    }
+    return data;
+}
+
+
+// Products p/q * q/p of the largest terms of T, whose unreduced numerators
+// overflow the accumulator of dot() after a few additions
+template <class F, class T>
+Data<F> spillData(std::size_t size)
+{
+    const T p = std::numeric_limits<T>::max(), q = p - 2;
+    Data<F> data;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const T sign = i % 4 == 3 ? T(-1) : T(1);
+        data.a.push_back(i % 2 ? F(sign * p, q) : F(sign * q, p));
+        data.b.push_back(i % 2 ? F(q, p) : F(p, q));
+        data.c.push_back(F(T(i % 7), T(3)));
+    }
+    return data;
+}
+
+
+typedef Fraction<BigInt, double> FractionB;
+
+
+// Exact value of a fraction, for references which must not overflow
+template <class F>
+FractionB exact(const F &f)
+{
+    return FractionB(BigInt(f.getNum()), BigInt(f.getDenom()));
+}
+
+
+template <class F>
+std::vector<FractionB> exact(const std::vector<F> &v)
+{
+    std::vector<FractionB> result;
+    for (const F &f : v)
+        result.push_back(exact(f));
+    return result;
+}
+
+
+// Whether every term of the exact fractions fits the integer type of F
+template <class F>
+bool fits(const std::vector<FractionB> &v)
+{
+    typedef typename F::integer_type T;
+    if constexpr (std::is_same<T, BigInt>::value)
+        return true;
+    else
+    {
+        const BigInt low(std::numeric_limits<T>::min()), high(std::numeric_limits<T>::max());
+        for (const FractionB &f : v)
+            if (f.getNum() < low || f.getNum() > high || f.getDenom() > high)
+                return false;
+        return true;
+    }
+}
+
+
+template <class F>
+void checkData(const Data<F> &data, const std::string &name)
+{
+    const std::size_t size = data.a.size();
+    const std::vector<FractionB> a = exact(data.a), b = exact(data.b), c = exact(data.c);
+
+    // References in arbitrary precision, where the naive loops cannot overflow
+    FractionB naive;
+    for (std::size_t i = 0; i < size; i++)
+        naive += a[i] * b[i];
+
+    std::vector<FractionB> expected(size);
+    for (std::size_t i = 0; i < size; i++)
+        expected[i] = a[i] * b[i] + c[i];
+
+    // fma() and axpy() have no wider fallback: each result has to fit F
+    check(fits<F>(expected), "fma reference fits, " + name);
+
+    // Serial, then split into chunks when there are enough fractions
+    for (unsigned threads : {1u, 4u})
+    {
+        const std::string where = name + ", size " + std::to_string(size) + ", " + std::to_string(threads) + " threads";
+
+        check(exact(dot(data.a.begin(), data.a.end(), data.b.begin(), threads)) == naive, "dot, " + where);
+
+        std::vector<F> out(size);
+        fma(data.a.begin(), data.a.end(), data.b.begin(), data.c.begin(), out.begin(), threads);
+        check(exact(out) == expected, "fma, " + where);
+
+        // In place, as allowed for the terms
+        out = data.c;
+        fma(data.a.begin(), data.a.end(), data.b.begin(), out.begin(), out.begin(), threads);
+        check(exact(out) == expected, "fma in place, " + where);
+
+        for (std::size_t k = 0; k < size && k < 3; k++)
+        {
+            std::vector<FractionB> reference = c;
+            for (std::size_t i = 0; i < size; i++)
+                reference[i] += a[k] * b[i];
+            if (!fits<F>(reference))
+                continue;
+
+            std::vector<F> y = data.c;
+            axpy(data.a[k], data.b.begin(), data.b.end(), y.begin(), threads);
+            check(exact(y) == reference, "axpy, " + where);
+        }
+    }
+}
+
+
+template <class F>
+void checkType(const std::string &name, int base, int range)
+{
+    std::mt19937_64 random(2026);
+
+    // Empty, short and serial ranges, then ranges above detail::fractionGrain
+    const std::size_t parallel = 3 * detail::fractionGrain + 17;
+    for (std::size_t size : {std::size_t(0), std::size_t(1), std::size_t(7), std::size_t(1000), parallel})
+    {
+        checkData(randomData<F>(size, random, base, range), name + " random");
+        checkData(groupedData<F>(size, random, range), name + " grouped");
+    }
+}
+
+
+template <class F, class T>
+void checkSpill(const std::string &name)
+{
+    for (std::size_t size : {std::size_t(3), std::size_t(64), 2 * detail::fractionGrain + 5})
+        checkData(spillData<F, T>(size), name + " spill");
+}
+
+
+int main()
+{
+    typedef Fraction<int, double> FractionI;
+    typedef Fraction<long long, double> FractionLL;
+
+    checkType<FractionI>("int", 12, 9);
+    checkType<FractionLL>("long long", 720, 100);
+    checkType<FractionB>("BigInt", 720720, 1000);
+
+    // Accumulators of 64 bits for int and 128 bits for long long
+    checkSpill<FractionI, int>("int");
+    checkSpill<FractionLL, long long>("long long");
+
+    // Same values in arbitrary precision, where nothing spills
+    for (std::size_t size : {std::size_t(64), 2 * detail::fractionGrain + 5})
+    {
+        const Data<FractionLL> data = spillData<FractionLL, long long>(size);
+        Data<FractionB> big;
+        for (std::size_t i = 0; i < size; i++)
+        {
+            big.a.push_back(FractionB(BigInt(data.a[i].getNum()), BigInt(data.a[i].getDenom())));
+            big.b.push_back(FractionB(BigInt(data.b[i].getNum()), BigInt(data.b[i].getDenom())));
+            big.c.push_back(FractionB(BigInt(data.c[i].getNum()), BigInt(data.c[i].getDenom())));
+        }
+        checkData(big, "BigInt spill");
+    }
+
+    if (failures == 0)
+        std::cout << "All checks passed" << std::endl;
+    return failures;
+}
@@ -0,0 +1,129 @@
+/**
+ * \file binary.cpp
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Checks of BinaryWriter and BinaryReader: round trips in every format, and
+ * truncated files which have to throw unless they hold a prefix of the
+ * fractions; the program returns the number of failed checks
+ *
+ * g++ -std=c++17 -O2 -Wall -Wextra -I.. binary.cpp -o binary
+ */
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../binary.h"
+
+using namespace frac;
+
+
+static int failures = 0;
+
+static void check(bool condition, const std::string &what)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+
+typedef Fraction<long, double> FractionL;
+
+
+static std::string readBytes(const std::string &path)
+{
+    std::ifstream in(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+
+static void writeBytes(const std::string &path, const std::string &bytes)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), std::streamsize(bytes.size()));
+}
+
+
+// Fractions of a file, or false if reading it throws
+static bool readAll(const std::string &path, std::vector<FractionL> &values)
+{
+    try
+    {
+        BinaryReader<long, double> reader(path);
+        values.assign(reader.begin(), reader.end());
+        (void) reader.size();
+    }
+    catch (const std::runtime_error &)
+    {
+        return false;
+    }
+    return true;
+}
+
+
+void checkFormat(BinaryFormat format, const std::string &name, const std::vector<FractionL> &data, const std::string &path)
+{
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        BinaryWriter<long, double> writer(out, format);
+        writer.write(data.begin(), data.end());
+    }
+
+    BinaryReader<long, double> reader(path);
+    check(reader.format() == format, name + ": format");
+    check(reader.size() == data.size(), name + ": size");
+    check(std::vector<FractionL>(reader.begin(), reader.end()) == data, name + ": round trip");
+
+    // A cut between two fractions leaves a valid file holding a prefix, any
+    // other cut has to throw. Blocks are runs of equal denominators here, so
+    // that a cut inside a block has to throw too.
+    const std::string bytes = readBytes(path);
+    const std::string truncated = path + ".truncated";
+    for (std::size_t size = 8; size < bytes.size(); size++)
+    {
+        writeBytes(truncated, bytes.substr(0, size));
+
+        std::vector<FractionL> values;
+        if (readAll(truncated, values))
+        {
+            const std::size_t n = values.size();
+            bool prefix = n < data.size() && std::equal(values.begin(), values.end(), data.begin());
+            if (format == BinaryFormat::SharedDenominator && n > 0)
+                prefix = prefix && data[n].getDenom() != data[n - 1].getDenom();
+            check(prefix, name + ": truncated to " + std::to_string(size) + " bytes");
+        }
+    }
+    std::filesystem::remove(truncated);
+}
+
+
+int main()
+{
+    // Runs of shared denominators, of one fraction, and large terms
+    std::mt19937_64 random(2026);
+    std::uniform_int_distribution<long> num(-1000, 1000), denom(1, 4), large(-(1L << 62), 1L << 62);
+    std::vector<FractionL> data;
+    for (int i = 0; i < 200; i++)
+        data.push_back(FractionL(num(random), denom(random)));
+    data.push_back(FractionL(large(random), 3));
+    data.push_back(FractionL(large(random), large(random) | 1L));
+
+    const std::string path = (std::filesystem::temp_directory_path() / "frac_binary_test.bin").string();
+    checkFormat(BinaryFormat::Varint, "varint", data, path);
+    checkFormat(BinaryFormat::SharedDenominator, "shared denominator", data, path);
+    checkFormat(BinaryFormat::Fixed, "fixed", data, path);
+    std::filesystem::remove(path);
+
+    if (failures == 0)
+        std::cout << "All checks passed" << std::endl;
+    return failures;
+}
@@ -0,0 +1,104 @@
+/**
+ * \file charconv.cpp
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Checks of from_chars() on valid input, zero denominators and overflows;
+ * the program returns the number of failed checks
+ *
+ * g++ -std=c++17 -O2 -Wall -Wextra -I.. charconv.cpp -o charconv
+ */
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <system_error>
+
+#include "../charconv.h"
+
+using namespace frac;
+
+
+static int failures = 0;
+
+static void check(bool condition, const std::string &what)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+
+// Parses text, checking the error code, the number of consumed characters
+// and, on success, the value
+template <class F>
+void checkParse(const char *text, std::errc ec, std::size_t offset, const F &expected = F())
+{
+    const F sentinel(-7, 3);
+    F value = sentinel;
+    const from_chars_result result = from_chars(text, text + std::strlen(text), value);
+
+    const std::string what = std::string("\"") + text + "\"";
+    check(result.ec == ec, "error code of " + what);
+    check(result.ptr == text + offset, "position of " + what);
+    check(value == (ec == std::errc() ? expected : sentinel), "value of " + what);
+}
+
+
+int main()
+{
+    typedef Fraction<int, double> FractionI;
+    typedef Fraction<long, double> FractionL;
+
+    const std::errc ok = std::errc(), invalid = std::errc::invalid_argument, range = std::errc::result_out_of_range;
+
+    // Valid forms
+    checkParse<FractionI>("3/4", ok, 3, FractionI(3, 4));
+    checkParse<FractionI>("-6/8 rest", ok, 4, FractionI(-3, 4));
+    checkParse<FractionI>("5/", ok, 1, FractionI(5));
+    checkParse<FractionI>("-2147483648/1", ok, 13, FractionI(-2147483647 - 1));
+    checkParse<FractionI>("2147483648/2", ok, 12, FractionI(1073741824));
+    checkParse<FractionL>("-1.25", ok, 5, FractionL(-5, 4));
+
+    // Decimals whose terms only fit once the power of ten is reduced
+    checkParse<FractionL>(".026920e16", ok, 10, FractionL(269200000000000L));
+    checkParse<FractionL>(".98639920E14", ok, 12, FractionL(98639920000000L));
+    checkParse<FractionL>("48E-20", ok, 6, FractionL(3, 6250000000000000000L));
+    checkParse<FractionL>("-52075E-20", ok, 10, FractionL(-2083, 4000000000000000000L));
+    checkParse<FractionL>("100000000000000000000e-10", ok, 25, FractionL(10000000000L));
+    checkParse<FractionL>("0.00000000000000000000000000001e29", ok, 34, FractionL(1L));
+    checkParse<FractionL>("6.380320100081753051200", ok, 23, FractionL(3987700062551095657L, 625000000000000000L));
+    checkParse<FractionI>("1200/3", ok, 6, FractionI(400));
+    checkParse<FractionI>("0e99999999999", ok, 13, FractionI(0));
+
+    // Decimals out of range
+    checkParse<FractionL>("1e19", range, 0);
+    checkParse<FractionL>("1e-19", range, 0);
+    checkParse<FractionL>("3e99999999999", range, 0);
+
+    // Zero denominators, with or without an overflow of the numerator
+    checkParse<FractionI>("1/0", invalid, 2);
+    checkParse<FractionI>("1/000", invalid, 2);
+    checkParse<FractionI>("4294967296/0", invalid, 11);
+    checkParse<FractionL>("92233720368547758070/00", invalid, 21);
+
+    // Overflows of the numerator
+    checkParse<FractionI>("4294967296/2", range, 0);
+    checkParse<FractionI>("-2147483649/1", range, 0);
+    checkParse<FractionL>("92233720368547758070/10", range, 0);
+
+    // Overflows of the denominator
+    checkParse<FractionI>("1/4294967296", range, 0);
+    checkParse<FractionI>("1/2147483648", range, 0);
+    checkParse<FractionL>("-1/92233720368547758070", range, 0);
+
+    // No digits
+    checkParse<FractionI>("", invalid, 0);
+    checkParse<FractionI>("-/3", invalid, 0);
+
+    if (failures == 0)
+        std::cout << "All checks passed" << std::endl;
+    return failures;
+}
@@ -0,0 +1,73 @@
+/**
+ * \file constexpr.cpp
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Compile time checks of Fraction: this translation unit only has to compile
+ *
+ * g++ -std=c++17 -Wall -Wextra -I.. -c constexpr.cpp
+ */
+
+#include <limits>
+#include <ratio>
+
+#include "../fraction.h"
+
+using namespace frac;
+
+
+// Construction, sign and reduction
+constexpr FractionLD half(2, 4);
+static_assert(half.getNum() == 1 && half.getDenom() == 2, "Construction should reduce");
+static_assert(FractionLD(3, -6).getNum() == -1 && FractionLD(3, -6).getDenom() == 2, "Denominator should be positive");
+static_assert(FractionLD(7L).getNum() == 7 && FractionLD(7L).getDenom() == 1, "Integer construction");
+static_assert(FractionLD().getNum() == 0 && FractionLD().getDenom() == 1, "Default construction");
+
+constexpr FractionLD reduced()
+{
+    // reduce() of a constant, the terms being already coprime for eager policies
+    FractionLD f(6, 8);
+    f.reduce();
+    return f;
+}
+static_assert(reduced().getNum() == 3 && reduced().getDenom() == 4, "reduce()");
+
+// Arithmetic
+static_assert(FractionLD(1, 2) + FractionLD(1, 3) == FractionLD(5, 6), "Addition");
+static_assert(FractionLD(1, 2) - FractionLD(1, 3) == FractionLD(1, 6), "Subtraction");
+static_assert(FractionLD(2, 3) * FractionLD(9, 4) == FractionLD(3, 2), "Multiplication");
+static_assert(FractionLD(2, 3) / FractionLD(4, 9) == FractionLD(3, 2), "Division");
+static_assert(-FractionLD(2, 3) == FractionLD(-2, 3), "Negation");
+static_assert(FractionLD(1, 2) + 1 == FractionLD(3, 2), "Addition of an integer");
+
+// Division by the most negative integer, whose opposite does not fit: an
+// overflow would not be a constant expression
+typedef Fraction<int, double> FractionI;
+typedef Fraction<int, double, WithArithmetic<CheckedArithmetic<>>> FractionIC;
+constexpr int intMin = std::numeric_limits<int>::min();
+static_assert(FractionI(2, 1) / intMin == FractionI(-1, 1073741824), "Division by the most negative integer");
+static_assert(FractionI(-4, 1) / intMin == FractionI(1, 536870912), "Division of a negative fraction by the most negative integer");
+static_assert(FractionIC(2, 1) / intMin == FractionIC(-1, 1073741824), "Checked division by the most negative integer");
+static_assert(FractionIC(0) / intMin == FractionIC(0), "Division of zero by the most negative integer");
+
+// Comparisons
+static_assert(FractionLD(1, 3) < FractionLD(1, 2), "operator<");
+static_assert(FractionLD(-1, 2) <= FractionLD(-1, 3), "operator<=");
+static_assert(FractionLD(2, 3) > FractionLD(3, 5), "operator>");
+static_assert(FractionLD(2, 4) >= FractionLD(1, 2), "operator>=");
+static_assert(FractionLD(2, 4) != FractionLD(1, 3), "operator!=");
+static_assert(FractionLD(1, 3).compare(FractionLD(1, 2)) < 0, "compare()");
+
+// Evaluation
+static_assert(FractionLD(1, 4).evaluate() == 0.25, "evaluate()");
+static_assert(FractionLD(-3, 8).evaluate() == -0.375, "evaluate() of a negative fraction");
+
+// Literals
+static_assert(3_fr / 4 == FractionLD(3, 4), "Integer literal");
+static_assert(0.75_fr == FractionLD(3, 4), "Floating literal");
+
+// std::ratio round trip
+constexpr FractionLD third = FractionLD(std::ratio<2, 6>());
+static_assert(third == FractionLD(1, 3), "Construction from std::ratio");
+typedef std::ratio<third.getNum(), third.getDenom()> Third;
+static_assert(std::ratio_equal<Third, std::ratio<1, 3>>::value, "Way back to std::ratio");
@@ -0,0 +1,127 @@
+/**
+ * \file conversion.cpp
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Checks of the conversions from floating numbers: the constructor gives back
+ * the number, approximate() the closest fraction under the bound; the program
+ * returns the number of failed checks
+ *
+ * g++ -std=c++17 -O2 -Wall -Wextra -I.. conversion.cpp -o conversion
+ */
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "../bigint.h"
+
+using namespace frac;
+
+
+static int failures = 0;
+
+static void check(bool condition, const std::string &what)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+
+typedef Fraction<BigInt, double> FractionB;
+
+
+// Exact value of a double, from its mantissa and exponent
+static FractionB exact(double x)
+{
+    int e = 0;
+    const double m = std::frexp(x, &e);
+    const BigInt mantissa((long long) std::ldexp(m, 53));
+    e -= 53;
+    if (e >= 0)
+        return FractionB(mantissa << unsigned(e), BigInt(1));
+    return FractionB(mantissa, BigInt(1) << unsigned(-e));
+}
+
+
+static FractionB distance(const FractionB &a, const FractionB &b)
+{
+    const FractionB d = a - b;
+    return d < FractionB(0) ? -d : d;
+}
+
+
+// Closest fraction by brute force, the smallest denominator on ties as limit_denominator
+static FractionB closest(double x, long max_denominator)
+{
+    const FractionB target = exact(x);
+    FractionB best(BigInt((long long) std::floor(x)));
+    for (long q = 1; q <= max_denominator; q++)
+    {
+        const long p = (long) std::floor(x * double(q));
+        for (long candidate = p - 1; candidate <= p + 2; candidate++)
+        {
+            const FractionB f{BigInt(candidate), BigInt(q)};
+            if (distance(f, target) < distance(best, target))
+                best = f;
+        }
+    }
+    return best;
+}
+
+
+template <class F>
+std::string str(const F &f)
+{
+    return std::to_string(f.getNum()) + "/" + std::to_string(f.getDenom());
+}
+
+
+int main()
+{
+    typedef Fraction<int, float> FractionIF;
+
+    // Expansions drifting from the number when run in floating point
+    check(FractionLD(0.12180250916963893).evaluate() == 0.12180250916963893, "0.12180250916963893");
+    check(FractionIF(-0.0305219386f).evaluate() == -0.0305219386f, "-0.0305219386f");
+    check(FractionLD(0.1) == FractionLD(1, 10), "0.1");
+
+    // Closest fraction rather than the first convergent rounding to the number
+    const FractionLD a = FractionLD::approximate(26.248809496813376, 457105519983L);
+    check(a == FractionLD(3509679522647L, 133708141052L), "approximate(26.248809496813376), got " + str(a));
+    const FractionLD b = FractionLD::approximate(-87.02414486921529, 249350917547786L);
+    check(b == FractionLD(-3061889893790891L, 35184372088832L), "approximate(-87.02414486921529), got " + str(b));
+
+    // Round trips of numbers whose exact value fits
+    std::mt19937_64 random(2026);
+    std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+    std::uniform_int_distribution<int> exponent(-8, 8);
+    for (int i = 0; i < 100000; i++)
+    {
+        const double x = std::ldexp(uniform(random), exponent(random));
+        check(FractionLD(x).evaluate() == x, "round trip of " + std::to_string(x));
+
+        const float y = float(x);
+        check(FractionIF(y).evaluate() == y, "round trip of float " + std::to_string(y));
+    }
+
+    // Bounded approximations against a brute force search
+    std::uniform_int_distribution<long> bound(1, 300);
+    for (int i = 0; i < 300; i++)
+    {
+        const double x = std::ldexp(uniform(random), exponent(random) / 2);
+        const long max_denominator = bound(random);
+        const FractionLD f = FractionLD::approximate(x, max_denominator);
+        const FractionB expected = closest(x, max_denominator);
+        check(FractionB(BigInt(f.getNum()), BigInt(f.getDenom())) == expected,
+              "approximate(" + std::to_string(x) + ", " + std::to_string(max_denominator) + "), got " + str(f));
+    }
+
+    if (failures == 0)
+        std::cout << "All checks passed" << std::endl;
+    return failures;
+}
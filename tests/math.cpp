@@ -0,0 +1,102 @@
+/**
+ * \file math.cpp
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Checks of floor(), ceil(), round() and trunc() on the extreme values of
+ * the integer types; the program returns the number of failed checks
+ *
+ * g++ -std=c++17 -O2 -Wall -Wextra -I.. math.cpp -o math
+ */
+
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "../fraction.h"
+#include "../math.h"
+
+using namespace frac;
+
+
+static int failures = 0;
+
+static void check(bool condition, const std::string &what)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+
+// Values near 0, near the halves of the range and near its ends
+template <class T>
+std::vector<T> extremes()
+{
+    const T low = std::numeric_limits<T>::min(), high = std::numeric_limits<T>::max();
+    std::vector<T> values;
+    for (T base : {T(0), T(low / 2), T(high / 2), low, high})
+        for (int offset = -3; offset <= 3; offset++)
+            if ((offset >= 0 || base > low - offset) && (offset <= 0 || base < high - offset))
+                values.push_back(T(base + offset));
+    return values;
+}
+
+
+// Each result is checked against its definition, computed in 128 bits
+template <class T>
+void checkType(const std::string &name)
+{
+    typedef __int128 W;
+    const std::vector<T> values = extremes<T>();
+
+    std::vector<T> num, denom;
+    for (T n : values)
+        for (T d : values)
+            if (d > 0)
+            {
+                num.push_back(n);
+                denom.push_back(d);
+            }
+
+    const std::size_t size = num.size();
+    std::vector<T> floors(size), ceils(size), rounds(size), truncs(size);
+    frac::floor(num.data(), denom.data(), floors.data(), size);
+    frac::ceil(num.data(), denom.data(), ceils.data(), size);
+    frac::round(num.data(), denom.data(), rounds.data(), size);
+    frac::trunc(num.data(), denom.data(), truncs.data(), size);
+
+    for (std::size_t i = 0; i < size; i++)
+    {
+        const W n = num[i], d = denom[i];
+        const std::string where = name + ", " + std::to_string(num[i]) + " / " + std::to_string(denom[i]);
+
+        check(floors[i] * d <= n && n < floors[i] * d + d, "floor, " + where);
+        check(ceils[i] * d - d < n && n <= ceils[i] * d, "ceil, " + where);
+        check(2 * W(rounds[i]) * d - d <= 2 * n && 2 * n < 2 * W(rounds[i]) * d + d, "round, " + where);
+        check(truncs[i] == (n < 0 ? ceils[i] : floors[i]), "trunc, " + where);
+    }
+
+    // Same results through the fractions, reduced by the constructor
+    for (std::size_t i = 0; i < size; i += 7)
+    {
+        const Fraction<T, double> f(num[i], denom[i]);
+        const std::string where = name + " fraction, " + std::to_string(num[i]) + " / " + std::to_string(denom[i]);
+        check(frac::floor(f) == floors[i] && frac::ceil(f) == ceils[i] && frac::round(f) == rounds[i] && frac::trunc(f) == truncs[i], where);
+    }
+}
+
+
+int main()
+{
+    checkType<int>("int");
+    checkType<long>("long");
+    checkType<long long>("long long");
+
+    if (failures == 0)
+        std::cout << "All checks passed" << std::endl;
+    return failures;
+}
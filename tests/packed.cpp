@@ -0,0 +1,84 @@
+/**
+ * \file packed.cpp
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Checks of the arithmetic of PackedFraction when the unreduced terms do not
+ * fit in 64 bits, and of AtomicFraction on such overflows; the program
+ * returns the number of failed checks
+ *
+ * g++ -std=c++17 -O2 -Wall -Wextra -pthread -I.. packed.cpp -o packed
+ */
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "../atomic_fraction.h"
+
+using namespace frac;
+
+
+static int failures = 0;
+
+static void check(bool condition, const std::string &what)
+{
+    if (!condition)
+    {
+        std::cerr << "FAILED: " << what << std::endl;
+        failures++;
+    }
+}
+
+
+// Tells whether the operation throws std::overflow_error
+template <class Function>
+bool overflows(Function &&operation)
+{
+    try
+    {
+        operation();
+    }
+    catch (const std::overflow_error &)
+    {
+        return true;
+    }
+    return false;
+}
+
+
+int main()
+{
+    typedef Packed64<32> P;
+    typedef P::wide_type Wide;
+
+    // Terms near 2^31 over denominators near 2^32: products of 64 bits or more
+    const long long big = (1LL << 31) - 1;
+    const P a(big, 4294967295LL), b(-big + 2, 4294967291LL), c(big, 3), d(7, 4294967291LL);
+
+    // Irreducible results fitting in Wide, through the wider fallback
+    check(a + (-a) == Wide(0LL), "a + (-a)");
+    check(a - a == Wide(0LL), "a - a");
+    check(Wide(a) * (P(1) / a) == Wide(1LL), "a * (1 / a)");
+    check(c * d == Wide(15032385529LL, 12884901873LL), "c * d");
+    check(a / d == Wide(9223372021822390277LL, 30064771065LL), "a / d");
+
+    // Irreducible results not fitting, reported instead of wrapped
+    check(overflows([&] { return a + b; }), "a + b");
+    check(overflows([&] { return a - (-b); }), "a - (-b)");
+    check(overflows([&] { return a * d; }), "a * d");
+
+    // The accumulators keep their value on overflow
+    AtomicFraction<> atomic(a);
+    check(overflows([&] { return atomic += Wide(b); }), "atomic a + b");
+    check(atomic.load() == Wide(a), "atomic value after an overflow");
+
+    ShardedFraction<> sharded;
+    sharded += Wide(a);
+    check(overflows([&] { sharded += Wide(b); }), "sharded a + b");
+    check(sharded.load() == Wide(a), "sharded value after an overflow");
+
+    if (failures == 0)
+        std::cout << "All checks passed" << std::endl;
+    return failures;
+}
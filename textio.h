@@ -0,0 +1,342 @@
+#ifndef _TEXTIO_H_
+#define _TEXTIO_H_
+
+/**
+ * \file textio.h
+ * \author Thomas BAUER
+ * \date October 16, 2026
+ *
+ * Bulk reading and writing of fractions as text and CSV files
+ */
+
+#include <cstddef>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "fraction.h"
+#include "charconv.h"
+#include "mapped.h"
+#include "parallel.h"
+
+
+/**
+ * \namespace frac
+ * \brief Namespace grouping the class Fraction and mathematical functions on rationals
+ */
+namespace frac
+{
+    /***************
+     * Declaration *
+     ***************/
+
+    /**
+     * \class ParseError
+     * \brief Exception thrown on an invalid fraction in a text
+     */
+    class ParseError : public std::invalid_argument
+    {
+    private:
+        std::size_t position;   /*!< Offset of the error from the beginning of the text */
+
+    public:
+        /**
+         * \brief Constructor
+         * \param[in] offset Offset of the error in bytes
+         * \param[in] ec Cause of the error, as given by from_chars()
+         */
+        ParseError(std::size_t offset, std::errc ec);
+
+        /**
+         * \brief Position getter
+         * \return Offset of the error from the beginning of the text, in bytes
+         */
+        std::size_t offset() const;
+    };
+
+
+    /**
+     * \brief Parsing of all the fractions of a text, computed in parallel
+     * \param[in] first Beginning of the text
+     * \param[in] last End of the text
+     * \param[out] out Container receiving the fractions with push_back(), such
+     * as std::vector<Fraction> or FractionArray
+     * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+     * \return Number of fractions appended to out
+     *
+     * Fractions are separated by spaces, tabulations, line breaks, commas or
+     * semicolons, in the format of from_chars(). The text is cut in chunks
+     * on separators, parsed in parallel, and the results appended in order.
+     * Throws ParseError on the first invalid fraction of the text.
+     */
+    template <class Container>
+    std::size_t parse(const char *first, const char *last, Container &out, unsigned threads = 0);
+
+    /**
+     * \brief Reading of all the fractions of a text or CSV file
+     * \param[in] path Path of the file, mapped in memory
+     * \param[out] out Container receiving the fractions, see parse()
+     * \param[in] threads Maximal number of threads, 0 for the hardware concurrency
+     * \return Number of fractions appended to out
+     */
+    template <class Container>
+    std::size_t read(const std::string &path, Container &out, unsigned threads = 0);
+
+
+    /**
+     * \class FractionWriter
+     * \brief Buffered formatting of fractions into a stream
+     *
+     * Fractions are written by to_chars() into a buffer, reused between
+     * flushes, which is handed to the stream in one write when full, so that
+     * the stream and its locale are not involved per fraction.
+     */
+    class FractionWriter
+    {
+    private:
+        std::ostream &stream;       /*!< Destination of the characters */
+        std::vector<char> buffer;   /*!< Characters not flushed yet, in [0, used) */
+        std::size_t used;           /*!< Number of characters in the buffer */
+        char separator;             /*!< Character written after each fraction */
+        Format format;              /*!< Representation of the fractions */
+        unsigned int precision;     /*!< Number of digits after the decimal point */
+
+    public:
+        /**
+         * \brief Constructor
+         * \param[in] o Destination stream
+         * \param[in] capacity Size of the buffer in bytes
+         * \param[in] sep Character written after each fraction
+         */
+        explicit FractionWriter(std::ostream &o, std::size_t capacity = std::size_t(1) << 20, char sep = '\n');
+
+        FractionWriter(const FractionWriter &) = delete;
+        FractionWriter &operator=(const FractionWriter &) = delete;
+
+        /**
+         * \brief Destructor, flushes the buffer
+         */
+        ~FractionWriter();
+
+        /**
+         * \brief Representation setter
+         * \param[in] f The representation of the next fractions, see to_chars()
+         * \param[in] digits Number of digits after the decimal point, for Format::Decimal
+         */
+        void setFormat(Format f, unsigned int digits = 6);
+
+        /**
+         * \brief Separator setter
+         * \param[in] sep Character written after each of the next fractions
+         */
+        void setSeparator(char sep);
+
+        /**
+         * \brief Writing of a fraction followed by the separator
+         * \param[in] value The fraction
+         */
+        template <class T1, class T2, class Policy>
+        void write(const Fraction<T1, T2, Policy> &value);
+
+        /**
+         * \brief Writing of a range of fractions, each followed by the separator
+         * \param[in] first Beginning of the range
+         * \param[in] last End of the range
+         */
+        template <class InputIt>
+        void write(InputIt first, InputIt last);
+
+        /**
+         * \brief Transfer of the buffer to the stream
+         */
+        void flush();
+    };
+
+
+
+    /******************
+     * Implementation *
+     ******************/
+    inline ParseError::ParseError(std::size_t offset, std::errc ec)
+        : std::invalid_argument("frac::parse: " + std::string(ec == std::errc::result_out_of_range ? "fraction out of range" : "invalid fraction")
+                                + " at byte " + std::to_string(offset)),
+          position(offset)
+    {
+    }
+
+
+    inline std::size_t ParseError::offset() const
+    {
+        return position;
+    }
+
+
+    namespace detail
+    {
+        /**
+         * \brief Tells whether a character separates two fractions
+         */
+        constexpr bool isSeparator(char c)
+        {
+            return c == ' ' || c == '\n' || c == '\r' || c == '\t' || c == ',' || c == ';';
+        }
+
+
+        /**
+         * \brief Minimal number of bytes of text handled by a thread
+         */
+        const std::size_t textGrain = std::size_t(1) << 20;
+    }
+
+
+    template <class Container>
+    std::size_t parse(const char *first, const char *last, Container &out, unsigned threads)
+    {
+        typedef typename Container::value_type F;
+
+        const std::size_t size = std::size_t(last - first);
+        unsigned chunks = detail::threadCount(size, detail::textGrain, threads);
+
+        // Chunks start after a separator, so that no fraction is cut
+        std::vector<const char *> bounds(chunks + 1, last);
+        bounds[0] = first;
+        for (unsigned chunk = 1; chunk < chunks; chunk++)
+        {
+            const char *p = first + size * chunk / chunks;
+            if (p < bounds[chunk - 1])
+                p = bounds[chunk - 1];
+            while (p != last && !detail::isSeparator(*p))
+                ++p;
+            bounds[chunk] = p;
+        }
+
+        std::vector<std::vector<F>> parts(chunks);
+        std::vector<const char *> errors(chunks, nullptr);
+        std::vector<std::errc> codes(chunks, std::errc());
+
+        detail::parallelFor(size, chunks, [&](unsigned chunk, std::size_t, std::size_t) {
+            const char *p = bounds[chunk], *end = bounds[chunk + 1];
+            std::vector<F> &part = parts[chunk];
+            part.reserve(std::size_t(end - p) / 8);
+
+            F value;
+            for (;;)
+            {
+                while (p != end && detail::isSeparator(*p))
+                    ++p;
+                if (p == end)
+                    break;
+
+                from_chars_result result = from_chars(p, end, value);
+                if (result.ec == std::errc() && result.ptr != end && !detail::isSeparator(*result.ptr))
+                    result = {result.ptr, std::errc::invalid_argument};    // Trailing garbage such as "1/2x"
+                if (result.ec != std::errc())
+                {
+                    errors[chunk] = result.ptr;
+                    codes[chunk] = result.ec;
+                    return;
+                }
+
+                part.push_back(value);
+                p = result.ptr;
+            }
+        });
+
+        for (unsigned chunk = 0; chunk < chunks; chunk++)
+        {
+            if (errors[chunk] != nullptr)
+                throw ParseError(std::size_t(errors[chunk] - first), codes[chunk]);
+        }
+
+        std::size_t count = 0;
+        for (std::vector<F> &part : parts)
+        {
+            for (const F &value : part)
+                out.push_back(value);
+            count += part.size();
+        }
+
+        return count;
+    }
+
+
+    template <class Container>
+    std::size_t read(const std::string &path, Container &out, unsigned threads)
+    {
+        MappedFile file(path);
+        return parse(file.data(), file.data() + file.size(), out, threads);
+    }
+
+
+    inline FractionWriter::FractionWriter(std::ostream &o, std::size_t capacity, char sep)
+        : stream(o), buffer(capacity < 64 ? 64 : capacity), used(0), separator(sep), format(Format::Ratio), precision(6)
+    {
+    }
+
+
+    inline FractionWriter::~FractionWriter()
+    {
+        this->flush();
+    }
+
+
+    inline void FractionWriter::setFormat(Format f, unsigned int digits)
+    {
+        format = f;
+        precision = digits;
+    }
+
+
+    inline void FractionWriter::setSeparator(char sep)
+    {
+        separator = sep;
+    }
+
+
+    template <class T1, class T2, class Policy>
+    void FractionWriter::write(const Fraction<T1, T2, Policy> &value)
+    {
+        for (;;)
+        {
+            // One byte is kept for the separator
+            if (used + 1 < buffer.size())
+            {
+                char *begin = buffer.data() + used, *end = buffer.data() + buffer.size() - 1;
+                to_chars_result result = to_chars(begin, end, value, format, precision);
+                if (result.ec == std::errc())
+                {
+                    *result.ptr = separator;
+                    used = std::size_t(result.ptr - buffer.data()) + 1;
+                    return;
+                }
+            }
+
+            // Retried after a flush, then in a larger buffer for huge terms
+            if (used > 0)
+                this->flush();
+            else
+                buffer.resize(2 * buffer.size());
+        }
+    }
+
+
+    template <class InputIt>
+    void FractionWriter::write(InputIt first, InputIt last)
+    {
+        for (; first != last; ++first)
+            this->write(*first);
+    }
+
+
+    inline void FractionWriter::flush()
+    {
+        if (used > 0)
+            stream.write(buffer.data(), std::streamsize(used));
+        used = 0;
+    }
+}
+
+
+#endif  /*_TEXTIO_H_*/